@@ -339,6 +339,12 @@ public:
 		return this->mT.template ForEach< T >(excitation);
 	}
 
+	template < typename T >
+	Index GatherContents(::std::vector< T >& contents)
+	{
+		return this->mT.template GatherContents< T >(contents);
+	}
+
 	//END: chemical::LinearStructureInterface methods
 
 	//START: chemical::Substance methods
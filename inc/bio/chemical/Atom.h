@@ -32,10 +32,17 @@
 #include "bio/physical/type/IsWave.h"
 #include "bio/physical/Quantum.h"
 #include "bio/physical/common/Class.h"
+#include "bio/physical/cache/CachedId.h"
 #include "bio/chemical/common/BondTypes.h"
 #include "PeriodicTable.h"
 #include "Bond.h"
 
+//@formatter:off
+#if BIO_CPP_VERSION >= 11
+	#include <atomic>
+#endif
+//@formatter:on
+
 namespace bio {
 namespace chemical {
 
@@ -75,6 +82,14 @@ public:
 	 */
 	explicit Atom(const Atom& other);
 
+	/**
+	 * Does what the implicit assignment operator did before the Bond position cache became atomic: other's Bonds are copied into *this as pointers. <br />
+	 * The Bond position cache is copied too, since the positions of the copied Bonds are unchanged. <br />
+	 * @param other
+	 * @return *this
+	 */
+	Atom& operator=(const Atom& other);
+
 	/**
 	 *
 	 */
@@ -134,15 +149,15 @@ public:
 		BIO_STATIC_ASSERT(!type::IsReference< T >())
 		BIO_STATIC_ASSERT(!type::IsPointer< T >())
 
-		Valence position = GetBondPosition< T >();
-		BIO_SANITIZE(position,
+		Bond* bond = GetBond(GetBondId< T >());
+		BIO_SANITIZE(bond,
 			,
 			return NULL
 		)
 
 		//What should be actually Bonded is a pointer to a physical::Class.
 		//This is performed by the chemical::Class constructor.
-		physical::Class< T >* bonded = ForceCast< physical::Class< T >* >(mBonds.OptimizedAccess(position)->GetBonded());
+		physical::Class< T >* bonded = ForceCast< physical::Class< T >* >(bond->GetBonded());
 		return bonded->GetWaveObject();
 	}
 
@@ -158,9 +173,9 @@ public:
 		BIO_STATIC_ASSERT(!type::IsReference< T >())
 		BIO_STATIC_ASSERT(!type::IsPointer< T >())
 
-		Valence position = GetBondPosition< T >();
-		BIO_SANITIZE(position, , return 0)
-		physical::Quantum< T >* bonded = ForceCast< physical::Quantum< T >* >(mBonds.OptimizedAccess(position)->GetBonded());
+		Bond* bond = GetBond(GetBondId< T >());
+		BIO_SANITIZE(bond, , return 0)
+		physical::Quantum< T >* bonded = ForceCast< physical::Quantum< T >* >(bond->GetBonded());
 		return bonded->GetQuantumObject();
 	}
 
@@ -236,15 +251,15 @@ public:
 		}
 
 		#if BIO_CPP_VERSION < 17
-		return SafelyAccess<PeriodicTable>()->GetIdFromType< physical::Quantum< T >* >();
+		return GetCachedBondId< physical::Quantum< T >* >();
 		#else
 		if constexpr(!type::IsWave< T >())
 		{
-			return SafelyAccess<PeriodicTable>()->GetIdFromType< physical::Quantum< T >* >();
+			return GetCachedBondId< physical::Quantum< T >* >();
 		}
 		else
 		{
-			return SafelyAccess<PeriodicTable>()->GetIdFromType< T* >();
+			return GetCachedBondId< T* >();
 		}
 		#endif
 	}
@@ -387,6 +402,7 @@ public:
 
 	/**
 	 * DANGEROUS! <br />
+	 * Do not remove Bonds from what is returned; Break them instead (see BreakBondImplementation()). <br />
 	 * @return a pointer to the Bonds in *this.
 	 */
 	Bonds* GetAllBonds();
@@ -425,8 +441,94 @@ public:
 		BondType type
 	);
 
+	/**
+	 * The number of entries in the Bond position cache of each Atom. <br />
+	 * Must be a power of 2. <br />
+	 */
+	static const ::std::size_t sBondSlots = 8;
+
 protected:
 	Bonds mBonds;
+
+	/**
+	 * An entry in the Bond position cache. <br />
+	 * Each slot is a sequence lock: mSequence is odd while the slot is being written, so readers can tell when they have read a mix of an old and a new entry. <br />
+	 */
+	struct BondSlot
+	{
+		//@formatter:off
+		#if BIO_CPP_VERSION >= 11
+			::std::atomic< uint32_t > mSequence;
+			::std::atomic< AtomicNumber > mId;
+			::std::atomic< Valence > mPosition;
+			::std::atomic< Bond* > mBond;
+		#else
+			volatile uint32_t mSequence;
+			volatile AtomicNumber mId;
+			volatile Valence mPosition;
+			Bond* volatile mBond;
+		#endif
+		//@formatter:on
+	};
+
+	/**
+	 * A direct-mapped cache of where each AtomicNumber is Bonded in mBonds, so that GetBondPosition() and As<>() do not need to search mBonds. <br />
+	 * Bonds are never removed from mBonds (Breaking a Bond leaves it in place), so entries are only written when Bonds are Formed. <br />
+	 * Reading a slot takes no lock and is safe while another thread Forms a Bond, since a torn read is detected and treated as a miss. <br />
+	 * Misses search mBonds, as before, which is only safe if no Bonds are being Formed at the same time. Forming Bonds on the same Atom from several threads at once is not supported. <br />
+	 * AtomicNumbers which share a slot evict each other. <br />
+	 */
+	BondSlot mBondSlots[sBondSlots];
+
+	/**
+	 * Empty every entry in mBondSlots. <br />
+	 */
+	void ClearBondSlots();
+
+	/**
+	 * Record where the given AtomicNumber is Bonded. <br />
+	 * @param bondedId
+	 * @param position
+	 */
+	void CacheBondPosition(
+		AtomicNumber bondedId,
+		Valence position
+	);
+
+	/**
+	 * Check mBondSlots for the given AtomicNumber, without searching mBonds. <br />
+	 * @param bondedId
+	 * @param position set to the position of the Bond, if found.
+	 * @param bond set to the Bond, if found.
+	 * @return whether or not bondedId was found.
+	 */
+	bool ReadBondSlot(
+		AtomicNumber bondedId,
+		Valence& position,
+		Bond*& bond
+	) const;
+
+	/**
+	 * @param bondedId
+	 * @return the Bond in *this for the given AtomicNumber, else NULL.
+	 */
+	Bond* GetBond(AtomicNumber bondedId) const;
+
+	/**
+	 * Looking up the AtomicNumber of a type requires locking the PeriodicTable, so we only do that once per type. <br />
+	 * The result is kept in a CachedId, which will be looked up again if the GlobalCache is Flush()ed. <br />
+	 * @tparam BONDED the type to look up in the PeriodicTable; must not be decorated beyond what GetBondId adds.
+	 * @return SafelyAccess<PeriodicTable>()->GetIdFromType< BONDED >().
+	 */
+	template < typename BONDED >
+	static AtomicNumber GetCachedBondId()
+	{
+		static const Name sName = type::TypeName< BONDED >(); //CachedId only holds a reference to its lookup.
+		static CachedId< AtomicNumber > sId(
+			sName,
+			PeriodicTable::Instance());
+		return sId;
+	}
 };
 
 } //chemical namespace
@@ -0,0 +1,208 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2022 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "Axis.h"
+#include "bio/physical/common/Types.h"
+#include <vector>
+
+//@formatter:off
+#if BIO_CPP_VERSION < 11
+	#include <stdint.h>
+#else
+	#include <cstdint>
+#endif
+//@formatter:on
+
+namespace bio {
+namespace chemical {
+
+/**
+ * A BinaryAxis Rotates whole chemical::Symmetry trees into a compact binary form and back, so that what Spin() produces can be checkpointed or sent elsewhere. <br />
+ * Unlike other Axes, nothing is built as text: encoding appends directly to a growable Buffer and decoding reads directly from one. <br />
+ *
+ * The encoding of a tree is a 4 byte little endian length, followed by that many bytes of Symmetries. <br />
+ * Each Symmetry is written as: <br />
+ *   its Id, as a varint <br />
+ *   the Id of its SymmetryType, as a varint <br />
+ *   the size of its value, as a varint <br />
+ *   if the size is not 0: the TypeId of its value, as 8 little endian bytes, followed by the bytes of its value, exactly as held by its ByteStream <br />
+ *   the number of Symmetries it contains, as a varint <br />
+ *   each of those Symmetries, in order. <br />
+ * A varint is an unsigned integer written 7 bits at a time, least significant first, with the high bit of each byte set while more bytes follow. <br />
+ *
+ * Trees which are nested more than sMaxDepth deep or whose encoding would be 4 GiB or more cannot be Rotated. <br />
+ *
+ * NOTE: Ids are written, not Names, so the Perspectives of the reader must assign the same Ids as those of the writer. <br />
+ * NOTE: values are written as raw memory, so they must not contain pointers and the reader must share the byte order of the writer. <br />
+ */
+class BinaryAxis :
+	public Axis
+{
+public:
+	/**
+	 * Where encoded Symmetries are written to and read from. <br />
+	 */
+	typedef ::std::vector< unsigned char > Buffer;
+
+	/**
+	 * How deeply Symmetries may be nested. <br />
+	 * Encoding and decoding recurse once per level, so this keeps a malformed (or malicious) encoding from overflowing the stack. <br />
+	 */
+	static const unsigned int sMaxDepth = 1024;
+
+	/**
+	 *
+	 */
+	BinaryAxis();
+
+	/**
+	 *
+	 */
+	virtual ~BinaryAxis();
+
+	/**
+	 * Encode symmetry and everything it contains. <br />
+	 * @param symmetry
+	 * @return the encoded bytes (which may include '\0') or Failed().
+	 */
+	virtual ::std::string Rotate(Symmetry* symmetry) const;
+
+	/**
+	 * Decode a tree previously produced by Rotate(Symmetry*). <br />
+	 * @param encoded
+	 * @return a new chemical::Symmetry or NULL if encoded is malformed.
+	 */
+	virtual physical::Symmetry* Rotate(::std::string encoded) const;
+
+	/**
+	 * Encode symmetry and everything it contains onto the end of out. <br />
+	 * @param symmetry
+	 * @param out
+	 * @return Success(), Invalid() if symmetry is NULL or BadArgument1() if symmetry is too deep or too large to encode, in which case out is left as it was.
+	 */
+	Code Rotate(
+		const Symmetry* symmetry,
+		Buffer& out
+	) const;
+
+	/**
+	 * Decode a tree previously produced by Rotate(const Symmetry*, Buffer&). <br />
+	 * @param in
+	 * @return a new Symmetry or NULL if in is malformed.
+	 */
+	Symmetry* Rotate(const Buffer& in) const;
+
+	/**
+	 * Decode the tree at the front of size bytes of in. <br />
+	 * Since each tree is prefixed with its length, this can be used to read several trees written to the same Buffer one after another. <br />
+	 * @param in
+	 * @param size
+	 * @param read will be set to the number of bytes consumed, if not NULL.
+	 * @return a new Symmetry or NULL if in is malformed.
+	 */
+	Symmetry* Rotate(
+		const unsigned char* in,
+		::std::size_t size,
+		::std::size_t* read = NULL
+	) const;
+
+protected:
+	/**
+	 * Encode a single Symmetry as a tree with no contents. <br />
+	 * This lets any physical::Wave be Rotated with operator|. <br />
+	 * @param symmetry
+	 * @return the encoded bytes or Failed().
+	 */
+	virtual ::std::string Encode(physical::Symmetry* symmetry) const;
+
+	/**
+	 * Write the Id, SymmetryType and value of symmetry. <br />
+	 * @param symmetry
+	 * @param out
+	 */
+	void EncodeSymmetry(
+		const physical::Symmetry* symmetry,
+		Buffer& out
+	) const;
+
+	/**
+	 * Write symmetry followed by all that it contains. <br />
+	 * @param symmetry
+	 * @param out
+	 * @param depth how many Symmetries contain symmetry.
+	 * @return false if the tree is nested more than sMaxDepth deep; true otherwise.
+	 */
+	bool EncodeTree(
+		const Symmetry* symmetry,
+		Buffer& out,
+		unsigned int depth = 0
+	) const;
+
+	/**
+	 * Read a Symmetry and all that it contains, advancing cursor past them. <br />
+	 * @param cursor
+	 * @param end
+	 * @param depth how many Symmetries contain the one being read.
+	 * @return a new Symmetry or NULL if the bytes between cursor and end are malformed or nested more than sMaxDepth deep.
+	 */
+	Symmetry* DecodeTree(
+		const unsigned char*& cursor,
+		const unsigned char* end,
+		unsigned int depth = 0
+	) const;
+
+	/**
+	 * @param value
+	 * @param out
+	 */
+	static void WriteVarInt(
+		uint64_t value,
+		Buffer& out
+	);
+
+	/**
+	 * @param cursor will be advanced past the varint.
+	 * @param end
+	 * @param value
+	 * @return whether or not a complete varint was read.
+	 */
+	static bool ReadVarInt(
+		const unsigned char*& cursor,
+		const unsigned char* end,
+		uint64_t& value
+	);
+
+	/**
+	 * Put the length of a tree in front of it. <br />
+	 * @param out
+	 * @param lengthPosition where the 4 bytes reserved for the length begin.
+	 * @return false, without writing anything, if the tree is too long for 4 bytes; true otherwise.
+	 */
+	static bool WriteLength(
+		Buffer& out,
+		::std::size_t lengthPosition
+	);
+};
+
+} //chemical namespace
+} //bio namespace
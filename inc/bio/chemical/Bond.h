@@ -24,6 +24,7 @@
 #include "bio/chemical/common/Types.h"
 #include "bio/chemical/common/BondTypes.h"
 #include "bio/common/container/Arrangement.h"
+#include "bio/common/macro/PoolMacros.h"
 
 namespace bio {
 
@@ -43,6 +44,12 @@ namespace chemical {
 class Bond
 {
 public:
+
+	/**
+	 * Atoms make & break many Bonds, so Bonds are allocated from an ObjectPool; see PoolMacros.h. <br />
+	 */
+	BIO_POOLED(Bond)
+
 	/**
 	 *
 	 */
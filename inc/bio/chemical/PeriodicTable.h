@@ -22,6 +22,7 @@
 #pragma once
 
 #include "bio/common/type/TypeName.h"
+#include "bio/common/type/TypeId.h"
 #include "bio/chemical/common/Types.h"
 #include "bio/physical/Perspective.h"
 
@@ -80,6 +81,11 @@ public:
 	template < typename T >
 	AtomicNumber GetIdFromType()
 	{
+		AtomicNumber ret = GetIdFromHash(type::TypeId< T >());
+		if (ret)
+		{
+			return ret;
+		}
 		return GetIdFromName(GetNameFromType< T >());
 	}
 
@@ -114,7 +120,26 @@ public:
 	template < typename T >
 	const Properties GetPropertiesOf() const
 	{
-		return GetPropertiesOf(type::TypeName< T >());
+		return GetPropertiesOf(GetIdFromHash(type::TypeId< T >()));
+	}
+
+	/**
+	 * GetPropertiesOf() which does not lock *this, if *this IsReadMostly(). <br />
+	 * Unlike GetPropertiesOf(), this gives empty Properties for types which have not been Recorded. <br />
+	 * Do not call this while *this is locked by the same thread (e.g. through SafelyAccess). <br />
+	 * @param id
+	 * @return whatever properties have been Recorded for the given type.
+	 */
+	const Properties ReadPropertiesOf(AtomicNumber id) const;
+
+	/**
+	 * @tparam T
+	 * @return ReadPropertiesOf() the given type.
+	 */
+	template < typename T >
+	const Properties ReadPropertiesOf() const
+	{
+		return ReadPropertiesOf(ReadIdFromHash(type::TypeId< T >()));
 	}
 
 	/**
@@ -218,6 +243,30 @@ public:
 	 * @return true if the association was removed else false.
 	 */
 	virtual bool DisassociateType(AtomicNumber id);
+
+protected:
+	/**
+	 * Records the Properties of the given Brane, if any have been recorded. <br />
+	 * Associated types are not recorded. <br />
+	 * @param brane
+	 * @param typeImage
+	 */
+	virtual void WriteTypeImage(
+		const Brane* brane,
+		::std::vector< unsigned char >& typeImage
+	) const;
+
+	/**
+	 * Records the Properties written by WriteTypeImage(), unless the given Brane already has Properties. <br />
+	 * @param brane
+	 * @param typeImage
+	 * @param size
+	 */
+	virtual void ReadTypeImage(
+		Brane* brane,
+		const unsigned char* typeImage,
+		::std::size_t size
+	);
 };
 
 BIO_SINGLETON(PeriodicTable,
@@ -97,10 +97,9 @@ public:
 		:
 		physical::Class< T >(
 			object,
-			new physical::Symmetry(
+			physical::Symmetry::FromPrototype< Class< T > >(
 				type::TypeName< T >(),
-				symmetryType
-			))
+				symmetryType))
 	{
 		CommonConstructor(filter);
 	}
@@ -121,10 +120,9 @@ public:
 		:
 		physical::Class< T >(
 			object,
-			new physical::Symmetry(
+			physical::Symmetry::FromPrototype< Class< T > >(
 				type::TypeName< T >(),
-				symmetryType
-			))
+				symmetryType))
 	{
 		CommonConstructor(filter);
 
@@ -156,10 +154,9 @@ public:
 		:
 		physical::Class< T >(
 			object,
-			new physical::Symmetry(
+			physical::Symmetry::FromPrototype< Class< T > >(
 				type::TypeName< T >(),
-				symmetryType
-			))
+				symmetryType))
 	{
 		CommonConstructor(filter);
 
@@ -191,7 +188,7 @@ public:
 	 */
 	virtual Properties GetProperties() const
 	{
-		return SafelyAccess<PeriodicTable>()->GetPropertiesOf< T >();
+		return PeriodicTable::Instance().ReadPropertiesOf< T >();
 	}
 
 	/**
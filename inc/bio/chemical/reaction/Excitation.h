@@ -25,11 +25,14 @@
 #include "bio/physical/macro/Macros.h"
 #include "bio/chemical/common/Properties.h"
 #include "bio/chemical/PeriodicTable.h"
+#include "bio/common/thread/ThreadPool.h"
+#include <vector>
 
 #if BIO_CPP_VERSION >= 17
 
 	#include <tuple>
 	#include <functional>
+	#include <type_traits>
 
 #endif
 
@@ -47,6 +50,8 @@ namespace chemical {
  * An Excitation is a Wave that stores a function pointer, i.e. a functor. <br />
  * Excitations allow you to directly invoke a Wave's methods. <br />
  * Excitations can be useful in propagating operations through Wave networks (e.g. an Atom's Bonds). Doing so will likely involve Modulating an Excitation onto a carrier Wave that dictates what the function applies to. <br />
+ *
+ * If calling an Excitation on one Wave never affects calling it on another, the Excitation may be marked Independent. ForEach<>() will then call it on all contents in parallel, using the ThreadPool. <br />
  */
 class ExcitationBase :
 	public physical::Class< ExcitationBase >
@@ -63,7 +68,10 @@ public:
 	 */
 	ExcitationBase()
 		:
-		physical::Class< ExcitationBase >(this)
+		physical::Class< ExcitationBase >(this),
+		mIsIndependent(false),
+		mProperties(GetClassProperties()),
+		mArePropertiesCached(true)
 	{
 
 	}
@@ -91,7 +99,7 @@ public:
 	 */
 	virtual Properties GetProperties() const
 	{
-		return GetClassProperties();
+		return mProperties;
 	}
 
 	/**
@@ -120,6 +128,215 @@ public:
 	{
 		//nop
 	}
+
+	/**
+	 * Mark *this as safe (or not) to be called on many Waves at once. <br />
+	 * Only do this if CallDown() on one Wave neither reads nor writes anything CallDown() on another Wave might write. <br />
+	 * @param isIndependent
+	 */
+	void SetIndependent(bool isIndependent = true)
+	{
+		mIsIndependent = isIndependent;
+	}
+
+	/**
+	 * @return whether or not *this may be called on many Waves at once; false by default.
+	 */
+	bool IsIndependent() const
+	{
+		return mIsIndependent;
+	}
+
+protected:
+	/**
+	 * Look up the Properties of WAVE once, so that GetProperties() does not need to lock the PeriodicTable each time *this is checked for Resonance. <br />
+	 * Call this from the constructor of any child which Resonates with a WAVE. <br />
+	 * The Properties of a type never change once Recorded, so they may be cached for good. <br />
+	 * If WAVE has not been Recorded in the PeriodicTable yet, nothing is cached and GetPropertiesOf< WAVE >() will look again each time. <br />
+	 * @tparam WAVE
+	 */
+	template < class WAVE >
+	void CacheProperties()
+	{
+		Properties waveProperties = PeriodicTable::Instance().ReadPropertiesOf< WAVE >();
+		mArePropertiesCached = waveProperties.GetAllocatedSize() > 0;
+		if (!mArePropertiesCached)
+		{
+			return;
+		}
+		mProperties.Clear();
+		mProperties.Import(waveProperties);
+		mProperties.Import(GetClassProperties());
+	}
+
+	/**
+	 * For implementing GetProperties() in children which Resonate with a WAVE. <br />
+	 * If CacheProperties() could not find the Properties of WAVE, this locks the PeriodicTable to look them up, which will fail sanitization if WAVE has still not been Recorded. <br />
+	 * @tparam WAVE
+	 * @return {whatever Properties WAVE has, property::Excitatory()}
+	 */
+	template < class WAVE >
+	Properties GetPropertiesOf() const
+	{
+		if (mArePropertiesCached)
+		{
+			return mProperties;
+		}
+		Properties ret = SafelyRead< PeriodicTable >()->GetPropertiesOf< WAVE >();
+		ret.Import(GetClassProperties());
+		return ret;
+	}
+
+	bool mIsIndependent;
+	Properties mProperties;
+	bool mArePropertiesCached;
+};
+
+/**
+ * Calls an ExcitationBase on a set of Waves as ParallelWork. <br />
+ * Each result is stored at the same position as its Wave, so the order of mResults does not depend on which threads do what. <br />
+ */
+class ParallelExcitation :
+	public ParallelWork
+{
+public:
+	/**
+	 * @param excitation
+	 */
+	ParallelExcitation(const ExcitationBase* excitation)
+		:
+		mExcitation(excitation)
+	{
+
+	}
+
+	/**
+	 *
+	 */
+	virtual ~ParallelExcitation()
+	{
+
+	}
+
+	/**
+	 * CallDown the Excitation on the Wave at index. <br />
+	 * @param index
+	 */
+	virtual void Work(const Index index)
+	{
+		mExcitation->CallDown(
+			mWaves[index],
+			&mResults[index]
+		);
+	}
+
+	const ExcitationBase* mExcitation;
+	::std::vector< physical::Wave* > mWaves;
+	::std::vector< ByteStream > mResults;
+};
+
+/**
+ * Calls a typed Excitation on a set of WAVEs, as ParallelWork when the Excitation IsIndependent(). <br />
+ * Unlike ParallelExcitation, this does not cast each Wave or box each result in a ByteStream, so it should be preferred when the caller already has typed pointers (e.g. from LinearMotif::GatherContents()). <br />
+ * Each result is stored at the same position as its WAVE. <br />
+ * @tparam EXCITATION the Excitation to call; must provide RETURN operator()(WAVE*) const.
+ * @tparam WAVE
+ * @tparam RESULT anything RETURN can be assigned to; usually RETURN or, for references, the type referred to.
+ */
+template < class EXCITATION, class WAVE, typename RESULT >
+class ExcitationBatch :
+	public ParallelWork
+{
+public:
+	/**
+	 * @param excitation
+	 * @param waves
+	 * @param results
+	 */
+	ExcitationBatch(
+		const EXCITATION* excitation,
+		WAVE* const* waves,
+		RESULT* results
+	)
+		:
+		mExcitation(excitation),
+		mWaves(waves),
+		mResults(results)
+	{
+
+	}
+
+	/**
+	 *
+	 */
+	virtual ~ExcitationBatch()
+	{
+
+	}
+
+	/**
+	 * Call the Excitation on the WAVE at index. <br />
+	 * @param index
+	 */
+	virtual void Work(const Index index)
+	{
+//@formatter:off
+#if BIO_CPP_VERSION >= 17
+		if constexpr (::std::is_void< decltype(mExcitation->operator()(mWaves[index])) >::value)
+		{
+			mExcitation->operator()(mWaves[index]);
+		}
+		else
+#endif
+//@formatter:on
+		{
+			mResults[index] = mExcitation->operator()(mWaves[index]);
+		}
+	}
+
+	/**
+	 * Call excitation on many WAVEs at once. <br />
+	 * If excitation IsIndependent(), the WAVEs are split across the ThreadPool. <br />
+	 * If RETURN is void (only possible with the C++17 Excitation), nothing is written to results, which may be NULL. <br />
+	 * @param excitation what to call.
+	 * @param waves the callers; must hold count WAVE*s.
+	 * @param count the number of waves.
+	 * @param results where to put the result of each call; must have room for count RESULTs.
+	 */
+	static void CallEach(
+		const EXCITATION* excitation,
+		WAVE* const* waves,
+		const Index count,
+		RESULT* results
+	)
+	{
+		BIO_SANITIZE(waves, , return)
+		ExcitationBatch< EXCITATION, WAVE, RESULT > batch(
+			excitation,
+			waves,
+			results
+		);
+		if (excitation->IsIndependent() && count > 1)
+		{
+			ThreadPool::Instance().Distribute(
+				&batch,
+				count
+			);
+			return;
+		}
+		for (
+			Index index = 0;
+			index < count;
+			++index
+			)
+		{
+			batch.Work(index);
+		}
+	}
+
+	const EXCITATION* mExcitation;
+	WAVE* const* mWaves;
+	RESULT* mResults;
 };
 
 #if BIO_CPP_VERSION >= 17
@@ -155,6 +372,7 @@ public:
 		mFunction(function),
 		mArgs(args...)
 	{
+		this->template CacheProperties< WAVE >();
 	}
 
 	/**
@@ -168,13 +386,12 @@ public:
 	/**
 	 * Override of Wave method. See that class for details. <br />
 	 * Ensures *this will Resonate with WAVEs by stealing their Properties from the PeriodicTable. <br />
+	 * The Properties are looked up when *this is constructed, so calling this does not lock the PeriodicTable, unless WAVE had not been Recorded yet. <br />
 	 * @return {whatever Properties WAVE has, property::Excitatory()}
 	 */
 	virtual Properties GetProperties() const
 	{
-		Properties ret = SafelyAccess<PeriodicTable>()->GetPropertiesOf< WAVE >();
-		ret.Import(ExcitationBase::GetClassProperties());
-		return ret;
+		return this->template GetPropertiesOf< WAVE >();
 	}
 
 	/**
@@ -207,6 +424,28 @@ public:
 		);
 	}
 
+	/**
+	 * Call *this on many WAVEs at once; see ExcitationBatch::CallEach(). <br />
+	 * @tparam RESULT
+	 * @param waves
+	 * @param count
+	 * @param results
+	 */
+	template < typename RESULT >
+	void CallEach(
+		WAVE* const* waves,
+		const Index count,
+		RESULT* results
+	) const
+	{
+		ExcitationBatch< Excitation< WAVE, RETURN, ARGUMENTS... >, WAVE, RESULT >::CallEach(
+			this,
+			waves,
+			count,
+			results
+		);
+	}
+
 	/**
 	 * Override of ExcitationBase; see above. <br />
 	 */
@@ -252,6 +491,7 @@ public:
 		physical::Class< ExcitationWithoutArgument< WAVE, RETURN > >(this),
 		mFunction(function)
 	{
+		this->template CacheProperties< WAVE >();
 	}
 
 	/**
@@ -265,13 +505,12 @@ public:
 	/**
 	 * Override of Wave method. See that class for details. <br />
 	 * Ensures *this will Resonate with WAVEs by stealing their Properties from the PeriodicTable. <br />
+	 * The Properties are looked up when *this is constructed, so calling this does not lock the PeriodicTable, unless WAVE had not been Recorded yet. <br />
 	 * @return {whatever Properties WAVE has, property::Excitatory()}
 	 */
 	virtual Properties GetProperties() const
 	{
-		Properties ret = SafelyAccess<PeriodicTable>()->GetPropertiesOf< WAVE >();
-		ret.Import(ExcitationBase::GetClassProperties());
-		return ret;
+		return this->template GetPropertiesOf< WAVE >();
 	}
 
 
@@ -284,6 +523,28 @@ public:
 		return (wave->*mFunction)();
 	}
 
+	/**
+	 * Call *this on many WAVEs at once; see ExcitationBatch::CallEach(). <br />
+	 * @tparam RESULT
+	 * @param waves
+	 * @param count
+	 * @param results
+	 */
+	template < typename RESULT >
+	void CallEach(
+		WAVE* const* waves,
+		const Index count,
+		RESULT* results
+	) const
+	{
+		ExcitationBatch< ExcitationWithoutArgument< WAVE, RETURN >, WAVE, RESULT >::CallEach(
+			this,
+			waves,
+			count,
+			results
+		);
+	}
+
 	/**
 	 * Override of ExcitationBase; see above. <br />
 	 */
@@ -331,6 +592,7 @@ public:
 		mFunction(function),
 		mArg(arg)
 	{
+		this->template CacheProperties< WAVE >();
 	}
 
 	/**
@@ -344,13 +606,12 @@ public:
 	/**
 	 * Override of Wave method. See that class for details. <br />
 	 * Ensures *this will Resonate with WAVEs by stealing their Properties from the PeriodicTable. <br />
+	 * The Properties are looked up when *this is constructed, so calling this does not lock the PeriodicTable, unless WAVE had not been Recorded yet. <br />
 	 * @return {whatever Properties WAVE has, property::Excitatory()}
 	 */
 	virtual Properties GetProperties() const
 	{
-		Properties ret = SafelyAccess<PeriodicTable>()->GetPropertiesOf< WAVE >();
-		ret.Import(ExcitationBase::GetClassProperties());
-		return ret;
+		return this->template GetPropertiesOf< WAVE >();
 	}
 
 	/**
@@ -377,6 +638,28 @@ public:
 		return (wave->*mFunction)(mArg);
 	}
 
+	/**
+	 * Call *this on many WAVEs at once; see ExcitationBatch::CallEach(). <br />
+	 * @tparam RESULT
+	 * @param waves
+	 * @param count
+	 * @param results
+	 */
+	template < typename RESULT >
+	void CallEach(
+		WAVE* const* waves,
+		const Index count,
+		RESULT* results
+	) const
+	{
+		ExcitationBatch< ExcitationWithArgument< WAVE, RETURN, ARGUMENT >, WAVE, RESULT >::CallEach(
+			this,
+			waves,
+			count,
+			results
+		);
+	}
+
 	/**
 	 * Override of ExcitationBase; see above. <br />
 	 */
@@ -432,6 +715,7 @@ public:
 		mArg1(arg1),
 		mArg2(arg2)
 	{
+		this->template CacheProperties< WAVE >();
 	}
 
 	/**
@@ -445,13 +729,12 @@ public:
 	/**
 	 * Override of Wave method. See that class for details. <br />
 	 * Ensures *this will Resonate with WAVEs by stealing their Properties from the PeriodicTable. <br />
+	 * The Properties are looked up when *this is constructed, so calling this does not lock the PeriodicTable, unless WAVE had not been Recorded yet. <br />
 	 * @return {whatever Properties WAVE has, property::Excitatory()}
 	 */
 	virtual Properties GetProperties() const
 	{
-		Properties ret = SafelyAccess<PeriodicTable>()->GetPropertiesOf< WAVE >();
-		ret.Import(ExcitationBase::GetClassProperties());
-		return ret;
+		return this->template GetPropertiesOf< WAVE >();
 	}
 
 	/**
@@ -487,6 +770,28 @@ public:
 		);
 	}
 
+	/**
+	 * Call *this on many WAVEs at once; see ExcitationBatch::CallEach(). <br />
+	 * @tparam RESULT
+	 * @param waves
+	 * @param count
+	 * @param results
+	 */
+	template < typename RESULT >
+	void CallEach(
+		WAVE* const* waves,
+		const Index count,
+		RESULT* results
+	) const
+	{
+		ExcitationBatch< ExcitationWithTwoArguments< WAVE, RETURN, ARGUMENT1, ARGUMENT2 >, WAVE, RESULT >::CallEach(
+			this,
+			waves,
+			count,
+			results
+		);
+	}
+
 	/**
 	 * Override of ExcitationBase; see above. <br />
 	 */
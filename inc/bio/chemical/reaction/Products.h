@@ -68,11 +68,33 @@ public:
 		const Substances* substances
 	);
 
+	/**
+	 * @param result
+	 * @param reactants
+	 */
+	Products(
+		Code result,
+		const Reactants* reactants
+	);
+
+	/**
+	 * Copies the Code and Substance pointers of other into *this, just like operator=. <br />
+	 * @param other
+	 */
+	Products(const Products& other);
+
 	/**
 	 *
 	 */
 	virtual ~Products();
 
+	/**
+	 * Copies the Code and Substance pointers of other into *this, in order. <br />
+	 * @param other
+	 * @return *this
+	 */
+	Products& operator=(const Products& other);
+
 	/**
 	 * @param code
 	 * @return whether or not the given code matches that of *this.
@@ -101,6 +123,12 @@ public:
 	 */
 	operator Reactants();
 
+	/**
+	 * For reading the Substances of *this without copying them (e.g. with Reactants::Reset()). <br />
+	 * @return the Substances in *this.
+	 */
+	const Substances& GetSubstances() const;
+
 protected:
 	Substances mSubstances;
 	Code mResult;
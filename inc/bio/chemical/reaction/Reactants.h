@@ -25,6 +25,8 @@
 #include "bio/chemical/structure/motif/LinearMotif.h"
 #include "bio/chemical/Substance.h"
 #include "bio/physical/common/Class.h"
+#include "bio/common/thread/ThreadSafe.h"
+#include <vector>
 
 namespace bio {
 namespace chemical {
@@ -68,6 +70,75 @@ public:
 	 * @return the Substances in *this.
 	 */
 	operator Substances();
+
+	/**
+	 * Add the Substances in *this to the end of substances, in order. <br />
+	 * Only pointers are copied. <br />
+	 * @param substances
+	 */
+	void Export(Substances& substances) const;
+
+	/**
+	 * Replace the contents of *this with the given Substances, reusing the storage *this already has. <br />
+	 * The Substances are neither Cloned nor owned by *this; only their pointers are copied. <br />
+	 * This lets the same Reactants be refilled for each step of a chain of Reactions (e.g. a molecular::Pathway). <br />
+	 * @param substances
+	 */
+	void Reset(const Substances& substances);
+};
+
+/**
+ * A ReactantsPool holds onto Reactants which are not in use, so that they (and their storage) can be reused rather than reallocated. <br />
+ * Copying a ReactantsPool does not copy the Reactants in it; the copy starts empty. <br />
+ */
+class ReactantsPool :
+	public ThreadSafe
+{
+public:
+
+	/**
+	 *
+	 */
+	ReactantsPool();
+
+	/**
+	 * Does not copy anything from toCopy. <br />
+	 * @param toCopy
+	 */
+	ReactantsPool(const ReactantsPool& toCopy);
+
+	/**
+	 * deletes all idle Reactants. <br />
+	 */
+	virtual ~ReactantsPool();
+
+	/**
+	 * Does not copy anything from toCopy. <br />
+	 * @param toCopy
+	 * @return *this
+	 */
+	ReactantsPool& operator=(const ReactantsPool& toCopy);
+
+	/**
+	 * Get an empty Reactants, either from *this or newly created. <br />
+	 * Give it back with Return() when you are done. <br />
+	 * @return an empty Reactants.
+	 */
+	Reactants* Borrow();
+
+	/**
+	 * Empty the given Reactants and keep it for the next Borrow(). <br />
+	 * @param reactants
+	 */
+	void Return(Reactants* reactants);
+
+	/**
+	 * @return how many Reactants *this is holding for reuse.
+	 */
+	Index GetNumberOfIdleReactants() const;
+
+protected:
+	::std::vector< Reactants* > mIdle;
 };
 
 } //chemical namespace
@@ -215,6 +215,20 @@ public:
 	 */
 	virtual Products operator()(Reactants* reactants) const;
 
+	/**
+	 * operator() for many sets of reactants at once. <br />
+	 * First, every set is checked against the requirements of *this, recording which ones pass in a Bitmap. Then, only the sets that passed are Process()ed. <br />
+	 * Sets that do not meet the requirements of *this (or are NULL) get a code::FailedReaction(). <br />
+	 * @param reactants the sets to check and Process; must hold count Reactants*.
+	 * @param count the number of sets.
+	 * @param products where to put the result of each set; must have room for count Products.
+	 */
+	virtual void ProcessEach(
+		Reactants* const* reactants,
+		const Index count,
+		Products* products
+	) const;
+
 	/**
 	 * Get a Reaction! <br />
 	 * This should be used to avoid unnecessary new and deletes. <br />
@@ -234,7 +248,11 @@ public:
 	template < typename T >
 	static const T* Initiate()
 	{
-		const T* ret = SafelyAccess<ReactionPerspective>()->template GetTypeFromNameAs< T >(type::TypeName< T >());
+		//The archetype is a Clone(), i.e. the physical::Class< T > Wave of a T, which may have more than 1 Wave.
+		//So, rather than Casting the Wave straight to T, we go through the physical::Class< T > it came from.
+		const physical::Class< T >* archetype = SafelyRead<ReactionPerspective>()->template GetTypeFromNameAs< const physical::Class< T >* >(type::TypeName< T >());
+		BIO_SANITIZE(archetype, , return NULL)
+		const T* ret = static_cast< const T* >(archetype);
 		BIO_SANITIZE_AT_SAFETY_LEVEL_1(ret,
 			return ret,
 			return NULL);
@@ -265,10 +283,50 @@ public:
 			return (*Cast< const T* >(RESULT))(&reactants),
 			return Products(
 				code::NotImplemented(),
-				reactants
+				&reactants
 			));
 	}
 
+	/**
+	 * Invokes a reaction of the given type on many sets of reactants. <br />
+	 * Unlike calling Attempt<T>() for each set, T is only Initiate()d once. <br />
+	 * See ProcessEach() for details. <br />
+	 * @tparam T a reaction type
+	 * @param reactants the sets to provide to T; must hold count Reactants*.
+	 * @param count the number of sets.
+	 * @param products where to put the result of each set; must have room for count Products. If T cannot be found, each will be a code::NotImplemented() holding its reactants.
+	 */
+	template < typename T >
+	static void AttemptBatch(
+		Reactants* const* reactants,
+		const Index count,
+		Products* products
+	)
+	{
+		BIO_SANITIZE(reactants && products, , return)
+		const T* reaction = Initiate< T >();
+		if (reaction)
+		{
+			reaction->ProcessEach(
+				reactants,
+				count,
+				products
+			);
+			return;
+		}
+		for (
+			Index index = 0;
+			index < count;
+			++index
+			)
+		{
+			products[index] = Products(
+				code::NotImplemented(),
+				reactants[index]
+			);
+		}
+	}
+
 	/**
 	 * Ease of use helper for invoking Reactions without creating a vector <br />
 	 * (Mostly useful for C++98) <br />
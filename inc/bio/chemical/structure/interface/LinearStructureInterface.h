@@ -203,6 +203,24 @@ public:
 			return Emission()
 		)
 	}
+
+	/**
+	 * Puts all contents into a contiguous buffer, in the order they were added (ForEach<>() visits them in reverse). <br />
+	 * Use this with Excitation::CallEach() to Excite all contents without boxing each result in a ByteStream. <br />
+	 * @tparam T
+	 * @param contents will be cleared, then filled.
+	 * @return the number of contents gathered.
+	 */
+	template < typename T >
+	Index GatherContents(::std::vector< T >& contents)
+	{
+		BIO_STATIC_ASSERT(type::IsPointer< T >())
+		LinearMotif< T >* implementer = this->As< LinearMotif< T >* >();
+		BIO_SANITIZE(implementer,
+			return implementer->GatherContentsImplementation(contents),
+			return 0
+		)
+	}
 };
 
 } //chemical namespace
@@ -147,9 +147,7 @@ public:
 			{
 				continue;
 			}
-			if (physical::Wave::GetResonanceBetween(
-				bond->GetBonded(),
-				AbstractMotif::GetClassProperties()).Size() == 0)
+			if (!physical::Wave::ResonatesWithClass< AbstractMotif >(bond->GetBonded()))
 			{
 				continue;
 			}
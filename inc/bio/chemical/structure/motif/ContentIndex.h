@@ -0,0 +1,292 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2022 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "bio/common/container/Bitmap.h"
+#include "bio/common/container/Container.h"
+#include "bio/common/type/IsId.h"
+
+namespace bio {
+namespace chemical {
+
+/**
+ * A ContentIndex lets an UnorderedMotif answer membership questions without searching its Contents. <br />
+ * This default implementation does nothing: only Ids (see type::IsId) can be indexed. <br />
+ * Motifs should check IsEnabled() before using any other method. <br />
+ * @tparam CONTENT_TYPE
+ * @tparam IS_ID whether or not CONTENT_TYPE can be used as an Index.
+ */
+template < typename CONTENT_TYPE, bool IS_ID = type::IsIdImplementation< CONTENT_TYPE >::sValue >
+class ContentIndex
+{
+public:
+	/**
+	 * @return false.
+	 */
+	static BIO_CONSTEXPR bool IsEnabled()
+	{
+		return false;
+	}
+
+	void Add(const CONTENT_TYPE /*content*/)
+	{
+		//nop
+	}
+
+	void Remove(
+		const CONTENT_TYPE /*content*/,
+		const Container* /*contents*/
+	)
+	{
+		//nop
+	}
+
+	void Clear()
+	{
+		//nop
+	}
+
+	void Invalidate()
+	{
+		//nop
+	}
+
+	void Refresh(const Container* /*contents*/)
+	{
+		//nop
+	}
+
+	void Import(const ContentIndex& /*other*/)
+	{
+		//nop
+	}
+
+	bool Has(
+		const CONTENT_TYPE /*content*/,
+		const Container* /*contents*/
+	) const
+	{
+		return false;
+	}
+
+	unsigned int GetNumMatching(
+		const Container* /*other*/,
+		const Container* /*contents*/
+	) const
+	{
+		return 0;
+	}
+};
+
+/**
+ * Ids are small, dense integers, so a set of Ids can be stored as a Bitmap, with bit n set if Id n is present. <br />
+ * That makes checking for an Id constant time and checking for a set of m Ids O(m), rather than O(n) and O(n*m) with a search. <br />
+ * The Contents of the Motif remain the authority; *this only mirrors them. <br />
+ * If the Contents might have been changed without going through *this (e.g. through a non-const GetAll()), *this should be Invalidate()d. <br />
+ * While stale, Has() and GetNumMatching() search the Contents instead, so that they never write to *this and may be called by any number of readers at once. The Motif should Refresh() *this before its next change to the Contents. <br />
+ * @tparam CONTENT_TYPE an Id.
+ */
+template < typename CONTENT_TYPE >
+class ContentIndex< CONTENT_TYPE, true >
+{
+public:
+	/**
+	 *
+	 */
+	ContentIndex()
+		:
+		mIsStale(false)
+	{
+	}
+
+	/**
+	 * @return true.
+	 */
+	static BIO_CONSTEXPR bool IsEnabled()
+	{
+		return true;
+	}
+
+	/**
+	 * Record that content was added to the Contents. <br />
+	 * @param content
+	 */
+	void Add(const CONTENT_TYPE content)
+	{
+		if (mIsStale)
+		{
+			return;
+		}
+		Insert(content);
+	}
+
+	/**
+	 * Record that content was removed from the Contents. <br />
+	 * Because the Contents may hold content more than once, they must be checked before content can be forgotten. <br />
+	 * @param content
+	 * @param contents the Contents content was removed from.
+	 */
+	void Remove(
+		const CONTENT_TYPE content,
+		const Container* contents
+	)
+	{
+		if (mIsStale)
+		{
+			return;
+		}
+		if (!contents->Has(content))
+		{
+			mMembership.Unset(content.mT);
+		}
+	}
+
+	/**
+	 * Record that the Contents are now empty. <br />
+	 */
+	void Clear()
+	{
+		mMembership.Clear();
+		mIsStale = false;
+	}
+
+	/**
+	 * Mark *this as no longer reflecting the Contents. <br />
+	 */
+	void Invalidate()
+	{
+		mIsStale = true;
+	}
+
+	/**
+	 * Record that the Contents of other were added to the Contents. <br />
+	 * This is O(words), rather than O(other's Contents). <br />
+	 * @param other
+	 */
+	void Import(const ContentIndex& other)
+	{
+		if (mIsStale)
+		{
+			return;
+		}
+		if (other.mIsStale)
+		{
+			mIsStale = true;
+			return;
+		}
+		mMembership.Union(other.mMembership);
+	}
+
+	/**
+	 * @param content
+	 * @param contents the Contents *this mirrors; searched instead if *this is stale.
+	 * @return whether or not content is in the Contents.
+	 */
+	bool Has(
+		const CONTENT_TYPE content,
+		const Container* contents
+	) const
+	{
+		if (mIsStale)
+		{
+			return contents->Has(content);
+		}
+		return mMembership.IsSet(content.mT);
+	}
+
+	/**
+	 * @param other a Container of CONTENT_TYPE.
+	 * @param contents the Contents *this mirrors; searched instead if *this is stale.
+	 * @return the number of elements in other that are also in the Contents.
+	 */
+	unsigned int GetNumMatching(
+		const Container* other,
+		const Container* contents
+	) const
+	{
+		unsigned int ret = 0;
+		for (
+			Index otr = other->GetBeginIndex();
+			otr != InvalidIndex();
+			otr = other->GetNextAllocatedIndex(otr + 1)
+			)
+		{
+			if (Has(
+				other->Access(otr).template As< CONTENT_TYPE >(),
+				contents
+			))
+			{
+				++ret;
+			}
+		}
+		return ret;
+	}
+
+	/**
+	 * Rebuild *this from contents, if *this is stale. <br />
+	 * Call this before changing the Contents, so that *this is kept up to date from then on. <br />
+	 * @param contents
+	 */
+	void Refresh(const Container* contents)
+	{
+		if (!mIsStale)
+		{
+			return;
+		}
+		mMembership.Clear();
+		for (
+			Index cnt = contents->GetBeginIndex();
+			cnt != InvalidIndex();
+			cnt = contents->GetNextAllocatedIndex(cnt + 1)
+			)
+		{
+			Insert(contents->Access(cnt).template As< CONTENT_TYPE >());
+		}
+		mIsStale = false;
+	}
+
+protected:
+	/**
+	 * Set the bit for content, growing mMembership as necessary. <br />
+	 * @param content
+	 */
+	void Insert(const CONTENT_TYPE content)
+	{
+		Index position = content.mT;
+		if (position >= mMembership.GetSize())
+		{
+			Index size = mMembership.GetSize() * 2;
+			if (size <= position)
+			{
+				size = position + 1;
+			}
+			mMembership.Resize(size);
+		}
+		mMembership.Set(position);
+	}
+
+	Bitmap mMembership;
+	bool mIsStale;
+};
+
+} //chemical namespace
+} //bio namespace
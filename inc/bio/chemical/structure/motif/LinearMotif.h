@@ -206,39 +206,27 @@ public:
 
 		Code ret = code::Success();
 
-		SmartIterator toReplace(
-			this->mContents,
-			InvalidIndex());
-
 		//Remove conflicts
-		for (
-			SmartIterator cnt = this->mContents->End();
-			!cnt.IsBeforeBeginning();
-			--cnt
-			)
+		//Only find 1 conflict, as no others should exist.
+		Index toReplace = Cast< physical::Line* >(this->mContents)->SeekToId(toAdd->GetId());
+		if (toReplace)
 		{
-			if (cnt.template As< CONTENT_TYPE >()->IsId(toAdd->GetId()))
-			{
-				//Not an error, but potentially worth noting.
-				ret = code::SuccessfullyReplaced();
-
-				toReplace = cnt;
-				break; //Only find 1 conflict, as no others should exist.
-			}
+			//Not an error, but potentially worth noting.
+			ret = code::SuccessfullyReplaced();
 		}
 
 		CONTENT_TYPE additionContent = CloneAndCast< CONTENT_TYPE >(toAdd);
 		BIO_SANITIZE(additionContent, , return code::GeneralFailure())
 		physical::Linear addition(additionContent);
 
-		if (this->mContents->IsAllocated(toReplace.GetIndex())) //i.e. GetIndex() != 0.
+		if (this->mContents->IsAllocated(toReplace)) //i.e. toReplace != 0.
 		{
 			if (transferSubContents)
 			{
 				//NOTE: THIS REMOVES ALL STRUCTURAL COMPONENTS IN toReplace WHICH ARE NOT EXPLICITLY IN addition
 				//This makes sense but is bound to be a bug at some point...
 
-				CONTENT_TYPE toReplaceCasted = toReplace.template As< CONTENT_TYPE >();
+				CONTENT_TYPE toReplaceCasted = ChemicalCast< CONTENT_TYPE >(Cast< physical::Line* >(this->mContents)->LinearAccess(toReplace));
 				//addition->ImportAll(toReplaceCasted); //<- inaccessible, so we replicate the function here.
 
 				Bond* bond;
@@ -253,9 +241,7 @@ public:
 					{
 						continue;
 					}
-					if (physical::Wave::GetResonanceBetween(
-						bond->GetBonded(),
-						AbstractMotif::GetClassProperties()).Size() == 0)
+					if (!physical::Wave::ResonatesWithClass< AbstractMotif >(bond->GetBonded()))
 					{
 						continue;
 					}
@@ -469,9 +455,7 @@ public:
 	 */
 	virtual Code Attenuate(const physical::Wave* other)
 	{
-		if (physical::Wave::GetResonanceBetween(
-			other,
-			ExcitationBase::GetClassProperties()).Size())
+		if (physical::Wave::ResonatesWithClass< ExcitationBase >(other))
 		{
 			ForEachImplementation(ChemicalCast< ExcitationBase* >(other));
 			return code::Success();
@@ -517,11 +501,39 @@ public:
 
 	/**
 	 * Performs the given Excitation on all contents. <br />
+	 * If the excitation IsIndependent(), the contents are done in parallel, though the order of the results is the same as if they were not. <br />
 	 * @param excitation
 	 */
 	virtual Emission ForEachImplementation(const ExcitationBase* excitation)
 	{
 		Emission ret;
+		if (excitation->IsIndependent() && this->mContents->GetNumberOfElements() > 1)
+		{
+			ParallelExcitation parallel(excitation);
+			parallel.mWaves.reserve(this->mContents->GetNumberOfElements());
+			for (
+				SmartIterator cnt = this->mContents;
+				!cnt.IsBeforeBeginning();
+				--cnt
+				)
+			{
+				parallel.mWaves.push_back(cnt.template As< physical::Linear >()->AsWave());
+			}
+			parallel.mResults.resize(parallel.mWaves.size());
+			ThreadPool::Instance().Distribute(
+				&parallel,
+				parallel.mWaves.size());
+			for (
+				::std::vector< ByteStream >::iterator rst = parallel.mResults.begin();
+				rst != parallel.mResults.end();
+				++rst
+				)
+			{
+				ret.Add(*rst);
+			}
+			return ret;
+		}
+
 		for (
 			SmartIterator cnt = this->mContents;
 			!cnt.IsBeforeBeginning();
@@ -538,6 +550,29 @@ public:
 		return ret;
 	}
 
+	/**
+	 * Implementation for gathering all contents. <br />
+	 * Contents are gathered in the order they are stored, i.e. the order in which they were added. <br />
+	 * @param contents will be cleared, then filled.
+	 * @return the number of contents gathered.
+	 */
+	virtual Index GatherContentsImplementation(::std::vector< CONTENT_TYPE >& contents) const
+	{
+		contents.clear();
+		contents.reserve(this->mContents->GetNumberOfElements());
+		for (
+			SmartIterator cnt(
+				this->mContents,
+				this->mContents->GetBeginIndex());
+			!cnt.IsAfterEnd();
+			++cnt
+			)
+		{
+			contents.push_back(ChemicalCast< CONTENT_TYPE >(cnt.template As< physical::Linear >().operator physical::Identifiable< Id >*()));
+		}
+		return contents.size();
+	}
+
 	/**
 	 * Gets the Names of all Contents and puts them into a string. <br />
 	 * @param separator e.g. ", ", the default, or just " ".
@@ -22,6 +22,7 @@
 #pragma once
 
 #include "AbstractMotif.h"
+#include "ContentIndex.h"
 #include "bio/chemical/macro/Macros.h"
 #include "bio/chemical/common/Class.h"
 #include "bio/physical/common/Filters.h"
@@ -35,6 +36,7 @@ namespace chemical {
 /**
  * UnorderedMotif classes have Content classes stored within them. <br />
  * They are simple containers. <br />
+ * If CONTENT_TYPE is an Id (e.g. Property or State), membership is also tracked in a ContentIndex, so that Has, HasAll, etc. do not need to search the Contents. <br />
  */
 template < typename CONTENT_TYPE >
 class UnorderedMotif :
@@ -69,6 +71,7 @@ public:
 		chemical::Class< UnorderedMotif< CONTENT_TYPE > >(this) //TODO: Define Symmetry.
 	{
 		this->mContents = new Contents(*contents);
+		this->mIndex.Invalidate();
 	}
 
 	/**
@@ -79,6 +82,7 @@ public:
 		chemical::Class< UnorderedMotif< CONTENT_TYPE > >(this) //TODO: Define Symmetry.
 	{
 		this->mContents = new Contents(*toCopy->mContents);
+		this->mIndex = toCopy->mIndex;
 	}
 
 	/**
@@ -95,6 +99,27 @@ public:
 	virtual void ClearImplementation()
 	{
 		this->mContents->Clear();
+		this->mIndex.Clear();
+	}
+
+	/**
+	 * Implementation for accessing all Contents. <br />
+	 * The Contents may be changed through the returned Container, so they will have to be reindexed. <br />
+	 * @return all Contents in *this.
+	 */
+	virtual Container* GetAllImplementation()
+	{
+		this->mIndex.Invalidate();
+		return this->mContents;
+	}
+
+	/**
+	 * Const interface for accessing all Contents. <br />
+	 * @return all Contents in *this.
+	 */
+	virtual const Container* GetAllImplementation() const
+	{
+		return this->mContents;
 	}
 
 	/**
@@ -113,7 +138,9 @@ public:
 	 */
 	virtual CONTENT_TYPE AddImplementation(const CONTENT_TYPE content)
 	{
+		this->mIndex.Refresh(this->mContents);
 		CONTENT_TYPE ret = this->mContents->Access(this->mContents->Add(content));
+		this->mIndex.Add(content);
 		return ret;
 	}
 
@@ -123,9 +150,14 @@ public:
 	 */
 	virtual CONTENT_TYPE RemoveImplementation(const CONTENT_TYPE content)
 	{
+		this->mIndex.Refresh(this->mContents);
 		Index toErase = this->mContents->SeekTo(content);
 		CONTENT_TYPE ret = this->mContents->Access(toErase);
 		this->mContents->Erase(toErase);
+		this->mIndex.Remove(
+			content,
+			this->mContents
+		);
 		return ret;
 	}
 
@@ -136,6 +168,13 @@ public:
 	 */
 	virtual bool HasImplementation(const CONTENT_TYPE content) const
 	{
+		if (this->mIndex.IsEnabled())
+		{
+			return this->mIndex.Has(
+				content,
+				this->mContents
+			);
+		}
 		return this->mContents->Has(content);
 	}
 
@@ -148,7 +187,9 @@ public:
 		BIO_SANITIZE(other, ,
 			return);
 
+		this->mIndex.Refresh(this->mContents);
 		this->mContents->Import(other->GetAllImplementation());
+		this->mIndex.Import(other->mIndex);
 	}
 
 	/**
@@ -161,6 +202,14 @@ public:
 		BIO_SANITIZE(other, ,
 			return 0);
 
+		if (this->mIndex.IsEnabled())
+		{
+			return this->mIndex.GetNumMatching(
+				other,
+				this->mContents
+			);
+		}
+
 		unsigned int ret = 0;
 		for (
 			SmartIterator otr = other->End();
@@ -209,6 +258,9 @@ public:
 		}
 		return ret;
 	}
+
+protected:
+	ContentIndex< CONTENT_TYPE > mIndex;
 };
 
 } //chemical namespace
@@ -25,6 +25,8 @@
 #include "bio/common/string/String.h"
 #include "bio/common/type/IsPointer.h"
 #include "bio/common/type/TypeName.h"
+#include "bio/common/type/TypeId.h"
+#include "bio/common/type/TypeTag.h"
 #include <cstddef>
 #include <cstdlib>
 #include <cstring>
@@ -45,6 +47,9 @@ namespace bio {
  * This is used by BIO_SANITIZE_WITH_CACHE and Containers. <br />
  *
  * NOTE: ByteStreams are not virtual to save what space we can. This may change in a future release if we decide we somehow need more hacky, abstract storage. <br />
+ *
+ * Values no larger than sInlineCapacity are stored within *this, rather than in a malloced block. <br />
+ * Because Containers memcpy ByteStreams into their stores, *this never keeps a pointer to itself; where the data lives is determined when it is accessed. <br />
  */
 class ByteStream
 {
@@ -57,8 +62,12 @@ public:
 	template < typename T >
 	ByteStream(T in)
 		:
+		mStream(NULL),
+		mTypeTag(NULL),
+		mTypeId(0),
+		mSize(0),
 		mHolding(false),
-		mTypeName(String::READ_ONLY)
+		mIsInline(false)
 	{
 		Set(in);
 	}
@@ -68,6 +77,14 @@ public:
 	 */
 	ByteStream(const ByteStream& other);
 
+	#if BIO_CPP_VERSION >= 11
+	/**
+	 * Takes whatever other was Holding, leaving other empty. <br />
+	 * @param other
+	 */
+	ByteStream(ByteStream&& other);
+	#endif
+
 	/**
 	 *
 	 */
@@ -78,6 +95,14 @@ public:
 	 */
 	void operator=(const ByteStream& other);
 
+	#if BIO_CPP_VERSION >= 11
+	/**
+	 * Takes whatever other was Holding, leaving other empty. <br />
+	 * @param other
+	 */
+	void operator=(ByteStream&& other);
+	#endif
+
 	/**
 	 * Compares the memory contained in both *this and other. <br />
 	 * @param other
@@ -121,9 +146,9 @@ public:
 
 		//@formatter: off
 		#if BIO_CPP_VERSION < 17
-			return *AsImplementation< T >(mStream).Get();
+			return *AsImplementation< T >(GetData()).Get();
 		#else
-			return *(T*)mStream;
+			return *(T*)GetData();
 		#endif
 		//@formatter:on
 	}
@@ -138,9 +163,9 @@ public:
 	{
 		//@formatter: off
 		#if BIO_CPP_VERSION < 17
-			return *AsImplementation< T >(mStream).Get();
+			return *AsImplementation< T >(GetData()).Get();
 		#else
-			return *(T*)mStream;
+			return *(T*)GetData();
 		#endif
 		//@formatter:on
 	}
@@ -178,14 +203,12 @@ public:
 	void Set(T in)
 	{
 		Release();
-		mStream = ::std::malloc(sizeof(T));
 		std::memcpy(
-			mStream,
+			Allocate(sizeof(T)),
 			&in,
 			sizeof(T));
-		mSize = sizeof(T);
-		mTypeName = type::TypeName< T >();
-		mHolding = true;
+		mTypeTag = type::GetTypeTag< T >();
+		mTypeId = type::TypeId< T >();
 	}
 
 	/**
@@ -193,6 +216,20 @@ public:
 	 */
 	void Set(const ByteStream& other);
 
+	/**
+	 * Copies size bytes from data into *this and Holds them, as if they had been Set from a type whose TypeId is typeId. <br />
+	 * This is how Axes restore values they have written out byte for byte. <br />
+	 * Is< T >() works as usual but GetTypeName() will be empty, since the name of the type cannot be recovered from its TypeId. <br />
+	 * @param data
+	 * @param size
+	 * @param typeId
+	 */
+	void Set(
+		const void* data,
+		const ::std::size_t size,
+		const type::TypeHash typeId
+	);
+
 	/**
 	 * Frees the memory *this was Holding. <br />
 	 * Nop if *this was not holding anything. <br />
@@ -219,7 +256,7 @@ public:
 		{
 			return false;
 		}
-		return mTypeName == type::TypeName< T >();
+		return mTypeId == type::TypeId< T >();
 
 		//NOTE: You may have a type T which might be a pointer to either a parent or a child class of what you keep in mStore. How do you know if what you have is convertable to T without access to the actual type of the data you store?
 		//ANSWER: You don't care. If the caller tries to pull anything out of *this besides what they put in, the caller is wrong and should be notified.
@@ -247,6 +284,11 @@ public:
 	 */
 	std::size_t GetSize() const;
 
+	/**
+	 * @return the TypeId of the type stored in *this; 0 if *this is empty.
+	 */
+	type::TypeHash GetTypeId() const;
+
 	/**
 	 * This is yet another strange and hacky function in the ByteStream menagerie. <br />
 	 * If a ByteStream is passed by reference to a function which copies the data of the ByteStream, the temporary variable needs to stop mHolding its mStream so that the copy can be in charge of Releasing the Held data. <br />
@@ -264,10 +306,49 @@ public:
 	 */
 	void* DirectAccess();
 
+	/**
+	 * Assume the caller knows something we don't. <br />
+	 * Please don't use this. <br />
+	 * @return the data in *this
+	 */
+	const void* DirectAccess() const;
+
+	/**
+	 * Values of this size or smaller will not be malloced. <br />
+	 */
+	static const ::std::size_t sInlineCapacity = 24;
+
 protected:
-	mutable void* mStream;
-	String mTypeName;
+	/**
+	 * @return where the data of *this lives.
+	 */
+	void* GetData() const
+	{
+		if (mIsInline)
+		{
+			return const_cast< unsigned char* >(mBuffer);
+		}
+		return mStream;
+	}
+
+	/**
+	 * Make room for size bytes and begin Holding them. <br />
+	 * *this must be Released first. <br />
+	 * @param size
+	 * @return where to write the data.
+	 */
+	void* Allocate(const ::std::size_t size);
+
+	union
+	{
+		void* mStream;
+		unsigned char mBuffer[sInlineCapacity];
+		long double mAlignment;
+	};
+	type::TypeTag mTypeTag; //only for GetTypeName().
+	type::TypeHash mTypeId;
 	std::size_t mSize;
 	bool mHolding;
+	bool mIsInline;
 };
 } //bio namespace
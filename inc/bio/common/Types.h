@@ -28,6 +28,7 @@
 #include "bio/common/container/Arrangement.h"
 #include "bio/common/container/SmartIterator.h"
 #include "bio/common/thread/SafelyAccess.h"
+#include "bio/common/thread/SafelyRead.h"
 #include "bio/common/thread/ThreadSafe.h"
 
 namespace bio {
@@ -23,11 +23,15 @@
 
 #include "Container.h"
 #include "bio/common/macro/Macros.h"
+#include "bio/common/Cast.h"
+#include <cstddef>
+#include <iterator>
 
 namespace bio {
 
 /**
  * Arrangements provide a memory-optimized implementation of the Container interface for a single type. <br />
+ * In addition to SmartIterators, Arrangements can be iterated with typed, non-virtual iterators (begin() & end(), so range-based for loops work) or ForEach(). <br />
  * @tparam TYPE
  */
 template < typename TYPE >
@@ -36,6 +40,97 @@ class Arrangement :
 {
 public:
 
+	/**
+	 * A typed, STL-compatible forward iterator over the allocated elements of an Arrangement. <br />
+	 * Unlike SmartIterators, these are not virtual, never allocate, and give TYPE& rather than ByteStreams. <br />
+	 * Adding to or Erasing from the Arrangement may invalidate these. <br />
+	 * @tparam VALUE TYPE or const TYPE
+	 * @tparam ARRANGEMENT Arrangement or const Arrangement
+	 */
+	template < typename VALUE, typename ARRANGEMENT >
+	class TypedIterator
+	{
+	public:
+		typedef ::std::forward_iterator_tag iterator_category;
+		typedef TYPE value_type;
+		typedef ::std::ptrdiff_t difference_type;
+		typedef VALUE* pointer;
+		typedef VALUE& reference;
+
+		/**
+		 * @param arrangement
+		 * @param index must be allocated in arrangement or InvalidIndex() for the end.
+		 */
+		TypedIterator(
+			ARRANGEMENT* arrangement,
+			const Index index
+		)
+			:
+			mArrangement(arrangement),
+			mIndex(index)
+		{
+		}
+
+		/**
+		 * @return the Index *this points to in its Arrangement.
+		 */
+		Index GetIndex() const
+		{
+			return mIndex;
+		}
+
+		reference operator*() const
+		{
+			return *ForceCast< VALUE* >(&mArrangement->mStore[mIndex * sizeof(TYPE)]);
+		}
+
+		pointer operator->() const
+		{
+			return ForceCast< VALUE* >(&mArrangement->mStore[mIndex * sizeof(TYPE)]);
+		}
+
+		TypedIterator& operator++()
+		{
+			mIndex = mArrangement->mOccupied.GetNextSet(mIndex + 1);
+			return *this;
+		}
+
+		TypedIterator operator++(int)
+		{
+			TypedIterator ret = *this;
+			++(*this);
+			return ret;
+		}
+
+		bool operator==(const TypedIterator& other) const
+		{
+			return mIndex == other.mIndex;
+		}
+
+		bool operator!=(const TypedIterator& other) const
+		{
+			return mIndex != other.mIndex;
+		}
+
+		/**
+		 * Allow iterators to be used as const_iterators.
+		 */
+		operator TypedIterator< const TYPE, const Arrangement >() const
+		{
+			return TypedIterator< const TYPE, const Arrangement >(
+				mArrangement,
+				mIndex
+			);
+		}
+
+	protected:
+		ARRANGEMENT* mArrangement;
+		Index mIndex;
+	};
+
+	typedef TypedIterator< TYPE, Arrangement > iterator;
+	typedef TypedIterator< const TYPE, const Arrangement > const_iterator;
+
 	/**
 	 * Like Containers, Arguments may only be constructed explicitly to avoid ambiguity when passing numbers to a function with 1 or many argument signatures.
 	 * @param expectedSize
@@ -128,6 +223,107 @@ public:
 		return *ForceCast< TYPE* >(&this->mStore[index * sizeof(TYPE)]);
 	}
 
+	/**
+	 * @return a typed iterator to the first allocated element of *this.
+	 */
+	iterator begin()
+	{
+		return iterator(
+			this,
+			this->mOccupied.GetNextSet(1));
+	}
+
+	/**
+	 * @return a typed iterator to the first allocated element of *this.
+	 */
+	const_iterator begin() const
+	{
+		return const_iterator(
+			this,
+			this->mOccupied.GetNextSet(1));
+	}
+
+	/**
+	 * @return a typed iterator past the last allocated element of *this.
+	 */
+	iterator end()
+	{
+		return iterator(
+			this,
+			InvalidIndex());
+	}
+
+	/**
+	 * @return a typed iterator past the last allocated element of *this.
+	 */
+	const_iterator end() const
+	{
+		return const_iterator(
+			this,
+			InvalidIndex());
+	}
+
+	/**
+	 * Calls function on every allocated element of *this, in order. <br />
+	 * This is the fastest way to visit everything in *this: the occupancy of *this is read a Word at a time and, as a template, the whole loop can be inlined. <br />
+	 * Do not Add to or Erase from *this within function. <br />
+	 * @tparam FUNCTION anything callable with a TYPE&.
+	 * @param function
+	 * @return function, like ::std::for_each.
+	 */
+	template < typename FUNCTION >
+	FUNCTION ForEach(FUNCTION function)
+	{
+		TYPE* store = ForceCast< TYPE* >(this->mStore);
+		Bitmap::Word word;
+		for (
+			::std::size_t wrd = 0;
+			wrd < this->mOccupied.GetWordCount();
+			++wrd
+			)
+		{
+			for (
+				word = this->mOccupied.GetWord(wrd);
+				word;
+				word &= word - 1
+				)
+			{
+				function(store[wrd * Bitmap::sWordBits + Bitmap::LowestSetBit(word)]);
+			}
+		}
+		return function;
+	}
+
+	/**
+	 * Calls function on every allocated element of *this, in order. <br />
+	 * This is the fastest way to visit everything in *this: the occupancy of *this is read a Word at a time and, as a template, the whole loop can be inlined. <br />
+	 * @tparam FUNCTION anything callable with a const TYPE&.
+	 * @param function
+	 * @return function, like ::std::for_each.
+	 */
+	template < typename FUNCTION >
+	FUNCTION ForEach(FUNCTION function) const
+	{
+		const TYPE* store = ForceCast< const TYPE* >(this->mStore);
+		Bitmap::Word word;
+		for (
+			::std::size_t wrd = 0;
+			wrd < this->mOccupied.GetWordCount();
+			++wrd
+			)
+		{
+			for (
+				word = this->mOccupied.GetWord(wrd);
+				word;
+				word &= word - 1
+				)
+			{
+				function(store[wrd * Bitmap::sWordBits + Bitmap::LowestSetBit(word)]);
+			}
+		}
+		return function;
+	}
+
 	/**
 	 * Please override this to return the size of the type your Container interface is working with. <br />
 	 * @return the size of the data type stored in *this.
@@ -0,0 +1,249 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2022 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "bio/common/container/common/Types.h"
+#include "bio/common/macro/Macros.h"
+#include <vector>
+
+//@formatter:off
+#if BIO_CPP_VERSION < 11
+	#include <stdint.h>
+#else
+	#include <cstdint>
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+	#include <intrin.h>
+#endif
+//@formatter:on
+
+namespace bio {
+
+/**
+ * A Bitmap is a dynamically sized set of bits, one per Index. <br />
+ * Bitmaps are used by Containers to track which Indices are allocated, so that checking an Index and finding the next or previous allocated Index do not require searching through every deallocated Index. <br />
+ * Searches operate on whole words at a time, making them roughly 64 times faster than checking each Index individually. <br />
+ *
+ * Like Containers, we reserve Index 0 as invalid: searches return InvalidIndex() when no set bit is found. <br />
+ * You may still Set(0), but it will never be found by a search. <br />
+ *
+ * NOTE: Bitmaps are not virtual and are not ThreadSafe. They are meant to be held by other classes which provide those features. <br />
+ */
+class Bitmap
+{
+public:
+
+	/**
+	 * The storage unit of *this. <br />
+	 */
+	typedef uint64_t Word;
+
+	/**
+	 * @param size the number of bits *this should hold; all bits start unset.
+	 */
+	explicit Bitmap(const Index size = 0);
+
+	/**
+	 *
+	 */
+	~Bitmap();
+
+	/**
+	 * @return the number of bits *this can hold.
+	 */
+	Index GetSize() const;
+
+	/**
+	 * Grow or shrink *this to hold the given number of bits. <br />
+	 * New bits are unset. Bits beyond the new size are lost. <br />
+	 * @param size
+	 */
+	void Resize(const Index size);
+
+	/**
+	 * Unset all bits in *this. <br />
+	 * The size of *this is not changed. <br />
+	 */
+	void Clear();
+
+	/**
+	 * Set every bit which is set in other, 1 Word at a time. <br />
+	 * *this grows to the size of other, if it is smaller. <br />
+	 * @param other
+	 */
+	void Union(const Bitmap& other);
+
+	/**
+	 * @param index
+	 * @return whether or not the bit at the given index is set; false if index is out of range.
+	 */
+	inline bool IsSet(const Index index) const
+	{
+		if (index >= mSize)
+		{
+			return false;
+		}
+		return (mWords[index / sWordBits] >> (index % sWordBits)) & 1;
+	}
+
+	/**
+	 * Set the bit at the given index. <br />
+	 * Nop if index is out of range. <br />
+	 * @param index
+	 */
+	inline void Set(const Index index)
+	{
+		BIO_SANITIZE_AT_SAFETY_LEVEL_1(index < mSize, , return)
+		mWords[index / sWordBits] |= (Word(1) << (index % sWordBits));
+	}
+
+	/**
+	 * Unset the bit at the given index. <br />
+	 * Nop if index is out of range. <br />
+	 * @param index
+	 */
+	inline void Unset(const Index index)
+	{
+		BIO_SANITIZE_AT_SAFETY_LEVEL_1(index < mSize, , return)
+		mWords[index / sWordBits] &= ~(Word(1) << (index % sWordBits));
+	}
+
+	/**
+	 * Find the first set bit at or after the given index. <br />
+	 * @param from
+	 * @return the Index of the next set bit or InvalidIndex().
+	 */
+	Index GetNextSet(const Index from) const;
+
+	/**
+	 * Find the last set bit at or before the given index. <br />
+	 * @param from
+	 * @return the Index of the previous set bit or InvalidIndex().
+	 */
+	Index GetPreviousSet(const Index from) const;
+
+	/**
+	 * Move every bit at or after the given index up by 1, leaving the bit at index unset. <br />
+	 * The size of *this is not changed, so the highest bit is lost. <br />
+	 * This mirrors Container::Insert. <br />
+	 * @param index
+	 */
+	void ShiftUpFrom(const Index index);
+
+	/**
+	 * @return the number of set bits in *this.
+	 */
+	Index Count() const;
+
+	/**
+	 * For iterating over set bits without going through GetNextSet(). <br />
+	 * @return the number of Words in *this.
+	 */
+	inline ::std::size_t GetWordCount() const
+	{
+		return mWords.size();
+	}
+
+	/**
+	 * For iterating over set bits without going through GetNextSet(). <br />
+	 * Bit i of the returned Word is Index (position * sWordBits + i). <br />
+	 * @param position must be less than GetWordCount().
+	 * @return the Word at the given position.
+	 */
+	inline Word GetWord(const ::std::size_t position) const
+	{
+		return mWords[position];
+	}
+
+	/**
+	 * @param word must not be 0.
+	 * @return the position of the lowest set bit in word.
+	 */
+	static inline unsigned int LowestSetBit(Word word)
+	{
+		#if defined(__GNUC__) || defined(__clang__)
+		return __builtin_ctzll(word);
+		#elif defined(_MSC_VER)
+		unsigned long ret;
+		_BitScanForward64(&ret, word);
+		return ret;
+		#else
+		unsigned int ret = 0;
+		while (!(word & 1))
+		{
+			word >>= 1;
+			++ret;
+		}
+		return ret;
+		#endif
+	}
+
+	/**
+	 * @param word must not be 0.
+	 * @return the position of the highest set bit in word.
+	 */
+	static inline unsigned int HighestSetBit(Word word)
+	{
+		#if defined(__GNUC__) || defined(__clang__)
+		return sizeof(Word) * 8 - 1 - __builtin_clzll(word);
+		#elif defined(_MSC_VER)
+		unsigned long ret;
+		_BitScanReverse64(&ret, word);
+		return ret;
+		#else
+		unsigned int ret = 0;
+		while (word >>= 1)
+		{
+			++ret;
+		}
+		return ret;
+		#endif
+	}
+
+	/**
+	 * @param word
+	 * @return the number of set bits in word.
+	 */
+	static inline unsigned int CountSetBits(Word word)
+	{
+		#if defined(__GNUC__) || defined(__clang__)
+		return __builtin_popcountll(word);
+		#else
+		unsigned int ret = 0;
+		while (word)
+		{
+			word &= word - 1;
+			++ret;
+		}
+		return ret;
+		#endif
+	}
+
+	static const Index sWordBits = sizeof(Word) * 8;
+
+protected:
+	std::vector< Word > mWords;
+	Index mSize;
+};
+
+} //bio namespace
@@ -27,6 +27,8 @@
 #include "bio/common/Cast.h"
 #include "bio/common/string/String.h"
 #include "SmartIterator.h"
+#include "Bitmap.h"
+#include "GrowthPolicy.h"
 #include <deque>
 #if BIO_CPP_VERSION >= 17
 	#include <tuple>
@@ -219,10 +221,27 @@ public:
 		return GetNumberOfElements();
 	}
 
+	/**
+	 * Find the first allocated Index at or after the given Index. <br />
+	 * This is what Iterators use to skip over deallocated Indices. <br />
+	 * @param index
+	 * @return the next allocated Index or InvalidIndex().
+	 */
+	virtual Index GetNextAllocatedIndex(const Index index) const;
+
+	/**
+	 * Find the last allocated Index at or before the given Index. <br />
+	 * This is what Iterators use to skip over deallocated Indices. <br />
+	 * @param index
+	 * @return the previous allocated Index or InvalidIndex().
+	 */
+	virtual Index GetPreviousAllocatedIndex(const Index index) const;
+
 	/**
 	 * Checks if the given Index is available to be allocated, i.e. the Index should not be used. <br />
 	 * NOTE: Just because a Index is not free does not necessarily mean the Index has been allocated. <br />
 	 * InvalidIndex is always Free. <br />
+	 * This is a constant time check against mOccupied. <br />
 	 * @param index
 	 * @return whether or not the given Index is free to use.
 	 */
@@ -243,10 +262,46 @@ public:
 
 	/**
 	 * Grow store to accommodate dynamic allocation. <br />
-	 * @param datumSize the memory size a Index should jump over.
+	 * How much *this grows is determined by its GrowthPolicy. <br />
 	 */
 	virtual void Expand();
 
+	/**
+	 * Make sure *this can hold at least the given number of Indices without Expanding. <br />
+	 * Nop if *this is already large enough. <br />
+	 * @param capacity
+	 * @return whether or not *this can now hold the given capacity.
+	 */
+	virtual bool Reserve(const Index capacity);
+
+	/**
+	 * Release any memory *this is not using. <br />
+	 * Deallocated Indices at the end of *this are forgotten; deallocated Indices in the middle of *this are kept so that all allocated Indices remain valid. <br />
+	 */
+	virtual void ShrinkToFit();
+
+	/**
+	 * Change how *this Expands. <br />
+	 * See GrowthPolicy.h for options. <br />
+	 * @param policy
+	 */
+	void SetGrowthPolicy(const GrowthPolicy& policy);
+
+	/**
+	 * @return how *this Expands.
+	 */
+	const GrowthPolicy& GetGrowthPolicy() const;
+
+	/**
+	 * @return the number of times *this has allocated or reallocated its store.
+	 */
+	Index GetAllocationCount() const;
+
+	/**
+	 * @return the largest number of bytes *this has held in its store at any one time.
+	 */
+	::std::size_t GetPeakBytes() const;
+
 	/**
 	 * Adds content to *this. <br />
 	 * @param content
@@ -391,20 +446,28 @@ public:
 
 	/**
 	 * Override this to construct Iterators for your Containers. <br />
+	 * Your Iterator should be constructed in the given storage (i.e. with placement new), so that iterating does not allocate. <br />
+	 * If your Iterator is larger than storageSize, return a new one instead; SmartIterators will delete it for you. <br />
 	 * @param index
-	 * @return a new Iterator pointing to the given Index in *this or NULL.
-	 */
-	virtual Iterator* ConstructClassIterator(const Index index = InvalidIndex()) const;
+	 * @param storage where to construct the Iterator.
+	 * @param storageSize the number of bytes available in storage.
+	 * @return an Iterator pointing to the given Index in *this or NULL.
+	 */
+	virtual Iterator* ConstructClassIterator(
+		const Index index,
+		void* storage,
+		const ::std::size_t storageSize
+	) const;
 
 	/**
 	 * NOTE: This does not need to be overridden if you've already defined ConstructClassIterator(). <br />
-	 * @return A new Iterator pointing to the beginning of *this.
+	 * @return A SmartIterator pointing to the beginning of *this.
 	 */
 	virtual SmartIterator Begin() const;
 
 	/**
 	 * NOTE: This does not need to be overridden if you've already defined ConstructClassIterator(). <br />
-	 * @return An Iterator pointing to the end of *this.
+	 * @return A SmartIterator pointing to the end of *this.
 	 */
 	virtual SmartIterator End() const;
 
@@ -437,6 +500,14 @@ protected:
 	 */
 	virtual const ::std::size_t GetStepSize() const;
 
+	/**
+	 * Resize mStore to hold the given number of Indices (including InvalidIndex). <br />
+	 * All allocation of mStore outside of ctors should go through here so that the allocation counters stay accurate. <br />
+	 * @param size
+	 * @return whether or not the reallocation succeeded.
+	 */
+	virtual bool Reallocate(const Index size);
+
 	/**
 	 * For ease of use when Add()ing. <br />
 	 * NOTE: This will mark the returned Index as filled, so please make sure it actually receives content. <br />
@@ -462,7 +533,20 @@ protected:
 
 	Index mSize;
 	Index mFirstFree;
+
+	/**
+	 * The order in which deallocated Indices will be reused. <br />
+	 */
 	std::deque< Index > mDeallocated;
+
+	/**
+	 * One bit per Index in mStore, set iff the Index is allocated. <br />
+	 */
+	Bitmap mOccupied;
+
+	GrowthPolicy mGrowthPolicy;
+	Index mAllocationCount;
+	::std::size_t mPeakBytes;
 };
 
 } //bio namespace
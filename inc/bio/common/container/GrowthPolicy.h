@@ -0,0 +1,99 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2022 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "bio/common/container/common/Types.h"
+
+namespace bio {
+
+/**
+ * A GrowthPolicy determines how much a Container will Expand when it runs out of room. <br />
+ * There are 3 Modes: <br />
+ * 1. GEOMETRIC: multiply the current size by some factor (e.g. 2 doubles the size each time). This is the default. <br />
+ * 2. FIXED_STEP: add the same number of Indices each time. <br />
+ * 3. CUSTOM: ask a user-provided Function what the next size should be. <br />
+ * <br />
+ * Regardless of Mode, the size returned by GetNextSize() will always be larger than the size given (unless there is no more room to grow). <br />
+ * GrowthPolicies are small and should be passed by value. <br />
+ */
+class GrowthPolicy
+{
+public:
+
+	typedef enum {
+		INVALID = 0,
+		GEOMETRIC,
+		FIXED_STEP,
+		CUSTOM,
+		MODE_MAX
+	} Mode;
+
+	/**
+	 * User-provided growth logic. <br />
+	 * @param currentSize
+	 * @return the number of Indices a Container should hold after Expanding.
+	 */
+	typedef Index (*Function)(const Index currentSize);
+
+	/**
+	 * @param factor how much to multiply the current size by; values <= 1 are treated as 2.
+	 * @return a GEOMETRIC GrowthPolicy.
+	 */
+	static GrowthPolicy Geometric(float factor = 2.0f);
+
+	/**
+	 * @param step how many Indices to add with each expansion; 0 is treated as 1.
+	 * @return a FIXED_STEP GrowthPolicy.
+	 */
+	static GrowthPolicy FixedStep(Index step);
+
+	/**
+	 * @param function what to call when determining the next size.
+	 * @return a CUSTOM GrowthPolicy.
+	 */
+	static GrowthPolicy Custom(Function function);
+
+	/**
+	 * Constructs the default GrowthPolicy, which is Geometric(2). <br />
+	 */
+	GrowthPolicy();
+
+	/**
+	 * @return the Mode of *this.
+	 */
+	Mode GetMode() const;
+
+	/**
+	 * Determine how large a Container should become. <br />
+	 * @param currentSize
+	 * @return a size larger than currentSize, or currentSize if it cannot grow any more.
+	 */
+	Index GetNextSize(const Index currentSize) const;
+
+protected:
+	Mode mMode;
+	float mFactor;
+	Index mStep;
+	Function mFunction;
+};
+
+} //bio namespace
@@ -60,6 +60,11 @@ public:
 	 */
 	Index GetIndex() const;
 
+	/**
+	 * @return the Container *this is iterating over.
+	 */
+	const Container* GetContainer() const;
+
 	/**
 	 * Make *this point somewhere else; <br />
 	 * @param index
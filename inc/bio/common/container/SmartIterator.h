@@ -32,11 +32,19 @@ class Iterator;
 /**
  * SmartIterators wrap our iterator interface to provide a consistent means of access. <br />
  * Everything is const so that we don't need to worry about const_iterator vs iterator nonsense. <br />
+ * <br />
+ * SmartIterators are meant to live on the stack. The Iterator *this wraps is constructed within *this (see Container::ConstructClassIterator()), so iterating does not allocate, unless the Iterator is larger than sInlineCapacity. <br />
+ * Copying a SmartIterator constructs a new Iterator at the same Index of the same Container. <br />
  */
 class SmartIterator
 {
 public:
 
+	/**
+	 * Iterators of this size or smaller will not be newed. <br />
+	 */
+	static const ::std::size_t sInlineCapacity = 4 * sizeof(void*);
+
 	/**
 	 * Sets mIndex to container->GetEndIndex(). <br />
 	 * @param container
@@ -52,11 +60,22 @@ public:
 		Index index
 	);
 
+	/**
+	 * @param toCopy
+	 */
+	SmartIterator(const SmartIterator& toCopy);
+
 	/**
 	 * Not virtual <br />
 	 */
 	~SmartIterator();
 
+	/**
+	 * @param toCopy
+	 * @return *this.
+	 */
+	SmartIterator& operator=(const SmartIterator& toCopy);
+
 	/**
 	 * Can check if *this is valid through multiple heuristics (e.g. Index() == InvalidIndex())
 	 * @return if *this points to a usable Index.
@@ -105,13 +124,13 @@ public:
 	 * Dereferencing gives the datum *this is currently pointing to. <br />
 	 * @return a ByteStream containing the datum requested.
 	 */
-	virtual ByteStream operator*();
+	ByteStream operator*();
 
 	/**
 	 * Dereferencing gives the datum *this is currently pointing to. <br />
 	 * @return a ByteStream containing the datum requested.
 	 */
-	virtual const ByteStream operator*() const;
+	const ByteStream operator*() const;
 
 	/**
 	 * Convenient casting wrapper. <br />
@@ -178,10 +197,31 @@ public:
 	SmartIterator operator--(int) const;
 
 protected:
+	/**
+	 * Construct mImplementation for the given Container. <br />
+	 * @param container
+	 * @param index
+	 */
+	void Construct(
+		const Container* container,
+		Index index
+	);
+
+	/**
+	 * Destroy mImplementation, deleting it only if it does not live in *this. <br />
+	 */
+	void Destruct();
+
 	/**
 	 * Whatever. Make it mutable. I don't care. <br />
 	 */
 	mutable Iterator* mImplementation;
+
+	union
+	{
+		unsigned char mBuffer[sInlineCapacity];
+		long double mAlignment;
+	};
 };
 
 } //bio namespace
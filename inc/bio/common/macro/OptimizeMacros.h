@@ -51,6 +51,28 @@
 	#define BIO_THREAD_ENFORCEMENT_LEVEL 2
 #endif
 
+/**
+ * BIO_THREAD_LOCK_POLICY selects what kind of lock each ThreadSafe object holds. <br />
+ * BIO_THREAD_LOCK_POLICY_NONE: no lock at all; the same as BIO_THREAD_ENFORCEMENT_LEVEL 0. <br />
+ * BIO_THREAD_LOCK_POLICY_MUTEX: a plain mutex; the default. <br />
+ * BIO_THREAD_LOCK_POLICY_SPIN: a spin lock, which is smaller than a mutex and faster when locks are held only briefly, but which burns cpu while waiting. <br />
+ * BIO_THREAD_LOCK_POLICY_SHARED: a reader/writer lock, which allows many SafelyRead<>s at once but makes each lock a little slower. <br />
+ * Where a policy is unavailable (e.g. a shared lock on c++11 outside of linux), the mutex is used instead. <br />
+ */
+#define BIO_THREAD_LOCK_POLICY_NONE 0
+#define BIO_THREAD_LOCK_POLICY_MUTEX 1
+#define BIO_THREAD_LOCK_POLICY_SPIN 2
+#define BIO_THREAD_LOCK_POLICY_SHARED 3
+
+#ifndef BIO_THREAD_LOCK_POLICY
+	#define BIO_THREAD_LOCK_POLICY BIO_THREAD_LOCK_POLICY_MUTEX
+#endif
+
+#if BIO_THREAD_LOCK_POLICY == BIO_THREAD_LOCK_POLICY_NONE
+	#undef BIO_THREAD_ENFORCEMENT_LEVEL
+	#define BIO_THREAD_ENFORCEMENT_LEVEL 0
+#endif
+
 /**
  * Certain places in the bio framework afford easy toggling between storing fewer variables and calculating the values only when needed or caching the values and only calculating them once (or as necessary). <br />
  * BIO_MEMORY_OPTIMIZE_LEVEL controls this tradeoff. <br />
@@ -62,6 +84,17 @@
 	#define BIO_MEMORY_OPTIMIZE_LEVEL 0
 #endif
 
+/**
+ * Small objects which are created and destroyed very often (e.g. Bonds, Symmetries, Quanta, and Surfaces) can be allocated from per-type ObjectPools, rather than the global new & delete. <br />
+ * Pooled memory is reused but not given back to the system until exit. <br />
+ * If you would rather use your own allocator (e.g. to check for leaks with your own tools), <br />
+ * #define BIO_OBJECT_POOLING 0 <br />
+ * See bio/common/memory/ObjectPool.h for more info. <br />
+ */
+#ifndef BIO_OBJECT_POOLING
+	#define BIO_OBJECT_POOLING 1
+#endif
+
 /**
  * The symmetry system is somewhat costly, especially on memory. <br />
  * If you do not need any of the features offered by Symmetry, <br />
@@ -0,0 +1,48 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2022 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "OptimizeMacros.h"
+#include "bio/common/memory/ObjectPool.h"
+
+/**
+ * Put this in the body of a class to allocate it from an ObjectPool, rather than with the global new & delete. <br />
+ * This is meant for small classes which are created and destroyed very often (e.g. Bonds and Symmetries). <br />
+ * Pooling can be turned off for all classes with BIO_OBJECT_POOLING (see OptimizeMacros.h). <br />
+ * NOTE: arrays (i.e. new className[]) are not pooled. <br />
+ * @param className the class being defined, with all template arguments (e.g. Quantum< T >).
+ */
+#if BIO_OBJECT_POOLING
+	#define BIO_POOLED(className)                                              \
+    static void* operator new(::std::size_t size)                              \
+    {                                                                          \
+        return ::bio::ObjectPoolFor< className >::Allocate(size);              \
+    }                                                                          \
+    static void operator delete(                                               \
+        void* block,                                                           \
+        ::std::size_t size)                                                    \
+    {                                                                          \
+        ::bio::ObjectPoolFor< className >::Deallocate(block, size);            \
+    }
+#else
+	#define BIO_POOLED(className)
+#endif
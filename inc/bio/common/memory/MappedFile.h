@@ -0,0 +1,117 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2022 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "bio/common/macro/OSMacros.h"
+#include "bio/common/macro/Macros.h"
+#include <cstddef>
+
+namespace bio {
+
+/**
+ * A MappedFile gives read-only access to the contents of a file without copying them. <br />
+ * On unix-like systems, the file is mmap()ed, so only the pages which are actually read are loaded and those pages may be shared between processes. <br />
+ * Elsewhere, the file is read into a single buffer. <br />
+ * Either way, GetData() is aligned for any type and stays valid until *this is Close()d or destroyed. <br />
+ *
+ * NOTE: MappedFiles cannot be copied, since they own their data. <br />
+ */
+class MappedFile
+{
+public:
+
+	/**
+	 *
+	 */
+	MappedFile();
+
+	/**
+	 * Open()s the file at the given path. Check IsOpen() for success. <br />
+	 * @param path
+	 */
+	explicit MappedFile(const char* path);
+
+	/**
+	 * Close()s *this. <br />
+	 */
+	~MappedFile();
+
+	/**
+	 * Map the file at the given path. <br />
+	 * Any previously opened file is Close()d first. <br />
+	 * Empty files cannot be opened. <br />
+	 * @param path
+	 * @return whether or not the file could be opened.
+	 */
+	bool Open(const char* path);
+
+	/**
+	 * Release the data of *this. <br />
+	 * Anything still pointing into GetData() becomes invalid. <br />
+	 */
+	void Close();
+
+	/**
+	 * @return whether or not *this holds the contents of a file.
+	 */
+	bool IsOpen() const;
+
+	/**
+	 * @return whether or not the file was mmap()ed, rather than read into memory.
+	 */
+	bool IsMapped() const;
+
+	/**
+	 * @return the contents of the opened file or NULL.
+	 */
+	const unsigned char* GetData() const;
+
+	/**
+	 * @return the number of bytes in GetData().
+	 */
+	::std::size_t GetSize() const;
+
+	/**
+	 * Replace the file at the given path with size bytes of data. <br />
+	 * @param path
+	 * @param data
+	 * @param size
+	 * @return whether or not all of data was written.
+	 */
+	static bool Write(
+		const char* path,
+		const void* data,
+		::std::size_t size
+	);
+
+protected:
+	const unsigned char* mData;
+	::std::size_t mSize;
+	bool mIsMapped;
+
+private:
+	MappedFile(const MappedFile& toCopy);
+
+	MappedFile& operator=(const MappedFile& toCopy);
+};
+
+} //bio namespace
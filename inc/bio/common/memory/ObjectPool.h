@@ -0,0 +1,275 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2022 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "bio/common/thread/ThreadSafe.h"
+#include "bio/common/container/common/Types.h"
+#include "bio/common/macro/Macros.h"
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace bio {
+
+/**
+ * The blocks of an ObjectPool held by 1 thread. <br />
+ * This must stay a POD, so that it can be thread local on c++98. <br />
+ */
+struct ObjectPoolCache
+{
+	void* mHead;
+	Index mCount;
+};
+
+/**
+ * An ObjectPool hands out fixed size blocks of memory, which are carved out of larger slabs. <br />
+ * Each thread keeps a small ObjectPoolCache of free blocks, so most Allocate()s and Deallocate()s take no lock. Only when a cache runs empty or grows too large does it trade a batch of blocks with *this, under the lock of *this. <br />
+ *
+ * Slabs are never returned to the system until *this is destroyed. <br />
+ * On c++11 and later, ObjectPoolFor<> gives a thread's cached blocks back when the thread exits. On c++98, those blocks are not reused, so at most 2 batches may be stranded per thread (unless ObjectPoolFor<>::ReleaseCache() is called first). <br />
+ *
+ * You probably want ObjectPoolFor<> or BIO_POOLED (see PoolMacros.h), rather than making your own ObjectPool. <br />
+ */
+class ObjectPool :
+	public ThreadSafe
+{
+public:
+
+	/**
+	 * @param blockSize the size of each block; this will be rounded up so that each block is aligned for any type.
+	 * @param blocksPerSlab how many blocks to get from the system at once.
+	 */
+	explicit ObjectPool(
+		const ::std::size_t blockSize,
+		const Index blocksPerSlab = 256
+	);
+
+	/**
+	 * Frees all slabs. <br />
+	 * Any blocks still in use become invalid. <br />
+	 */
+	virtual ~ObjectPool();
+
+	/**
+	 * @param cache the calling thread's cache for *this.
+	 * @return a block of GetBlockSize() bytes.
+	 */
+	inline void* Allocate(ObjectPoolCache* cache)
+	{
+		if (!cache->mHead)
+		{
+			Refill(cache);
+		}
+		void* ret = cache->mHead;
+		cache->mHead = *static_cast< void** >(ret);
+		--cache->mCount;
+		return ret;
+	}
+
+	/**
+	 * @param block must have come from Allocate() on *this (on any thread).
+	 * @param cache the calling thread's cache for *this.
+	 */
+	inline void Deallocate(
+		void* block,
+		ObjectPoolCache* cache
+	)
+	{
+		*static_cast< void** >(block) = cache->mHead;
+		cache->mHead = block;
+		if (++cache->mCount > 2 * sBatchSize)
+		{
+			Drain(
+				cache,
+				sBatchSize
+			);
+		}
+	}
+
+	/**
+	 * Give all blocks in cache back to *this. <br />
+	 * @param cache
+	 */
+	void Release(ObjectPoolCache* cache);
+
+	/**
+	 * @return the size of each block, after rounding.
+	 */
+	::std::size_t GetBlockSize() const;
+
+	/**
+	 * @return the number of blocks *this has gotten from the system.
+	 */
+	Index GetNumberOfBlocks() const;
+
+	/**
+	 * Does not include blocks held in the caches of any thread. <br />
+	 * @return the number of free blocks held by *this.
+	 */
+	Index GetNumberOfFreeBlocks() const;
+
+	/**
+	 * How many blocks are moved between *this and a cache at once. <br />
+	 */
+	static const Index sBatchSize = 32;
+
+protected:
+	/**
+	 * Move up to sBatchSize blocks from *this into cache, making a new slab if needed. <br />
+	 * @param cache
+	 */
+	void Refill(ObjectPoolCache* cache);
+
+	/**
+	 * Move count blocks from cache into *this. <br />
+	 * @param cache
+	 * @param count
+	 */
+	void Drain(
+		ObjectPoolCache* cache,
+		Index count
+	);
+
+	::std::size_t mBlockSize;
+	Index mBlocksPerSlab;
+	::std::vector< void* > mSlabs;
+	void* mFree;
+	Index mNumberOfFree;
+};
+
+/**
+ * ObjectPoolFor<> gives each type its own ObjectPool and a thread local cache for it. <br />
+ * Only objects of exactly sizeof(T) are pooled. Anything else (e.g. a child of T which did not use BIO_POOLED itself) goes to the global new & delete. <br />
+ * @tparam T
+ */
+template < typename T >
+class ObjectPoolFor
+{
+public:
+	/**
+	 * The pool is never destroyed, so objects may safely be deleted during static destruction. <br />
+	 * @return the ObjectPool for T.
+	 */
+	static ObjectPool& GetPool()
+	{
+		static ObjectPool* sPool = new ObjectPool(sizeof(T));
+		return *sPool;
+	}
+
+	/**
+	 * @return the calling thread's cache for GetPool().
+	 */
+	static ObjectPoolCache* GetCache()
+	{
+		//@formatter:off
+		#if BIO_CPP_VERSION >= 11
+			static thread_local CacheReleaser sCache;
+			return &sCache.mCache;
+		#else
+			static __thread ObjectPoolCache sCache = {NULL, 0};
+			return &sCache;
+		#endif
+		//@formatter:on
+	}
+
+	/**
+	 * For operator new. <br />
+	 * @param size
+	 * @return a block of at least size bytes.
+	 */
+	static void* Allocate(const ::std::size_t size)
+	{
+		if (size != sizeof(T))
+		{
+			return ::operator new(size);
+		}
+		return GetPool().Allocate(GetCache());
+	}
+
+	/**
+	 * For operator delete. <br />
+	 * @param block
+	 * @param size must be the same as what was given to Allocate().
+	 */
+	static void Deallocate(
+		void* block,
+		const ::std::size_t size
+	)
+	{
+		if (!block)
+		{
+			return;
+		}
+		if (size != sizeof(T))
+		{
+			::operator delete(block);
+			return;
+		}
+		GetPool().Deallocate(
+			block,
+			GetCache());
+	}
+
+	/**
+	 * Give the calling thread's cached blocks back to the pool. <br />
+	 * Call this before a thread exits, if you would like its blocks to be reused. <br />
+	 */
+	static void ReleaseCache()
+	{
+		GetPool().Release(GetCache());
+	}
+
+	/**
+	 * For leak checking. <br />
+	 * This is only exact if no other thread has blocks in its cache (e.g. they have all called ReleaseCache()). <br />
+	 * @return the number of Ts which have been allocated but not yet deallocated.
+	 */
+	static Index GetNumberInUse()
+	{
+		ReleaseCache();
+		return GetPool().GetNumberOfBlocks() - GetPool().GetNumberOfFreeBlocks();
+	}
+
+protected:
+	#if BIO_CPP_VERSION >= 11
+	/**
+	 * Gives a thread's cached blocks back to the pool when that thread exits. <br />
+	 */
+	struct CacheReleaser
+	{
+		CacheReleaser()
+		{
+			mCache.mHead = NULL;
+			mCache.mCount = 0;
+		}
+
+		~CacheReleaser()
+		{
+			GetPool().Release(&mCache);
+		}
+
+		ObjectPoolCache mCache;
+	};
+	#endif
+};
+
+} //bio namespace
@@ -27,6 +27,14 @@
 #include <cstring>
 #include <cstdlib>
 
+//@formatter:off
+#if BIO_CPP_VERSION < 11
+	#include <stdint.h>
+#else
+	#include <cstdint>
+#endif
+//@formatter:on
+
 namespace bio {
 
 /**
@@ -126,6 +134,35 @@ public:
 		return mLength;
 	}
 
+	/**
+	 * Unlike String::AsCharString(), this does not copy anything. <br />
+	 * @return the first of Length() characters in *this, which are not necessarily followed by a '\0'; may be NULL.
+	 */
+	BIO_CONSTEXPR const char* GetCharacters() const
+	{
+		return mString;
+	}
+
+	/**
+	 * Hash the characters in *this using 64 bit FNV-1a. <br />
+	 * Equal strings produce equal hashes, regardless of where they are stored or what Mode they are in. <br />
+	 * @return a 64 bit hash of the contents of *this.
+	 */
+	BIO_CONSTEXPR uint64_t GetHash() const
+	{
+		uint64_t ret = 14695981039346656037ULL;
+		for (
+			::std::size_t chr = 0;
+			chr < mLength;
+			++chr
+			)
+		{
+			ret ^= uint64_t((unsigned char)mString[chr]);
+			ret *= 1099511628211ULL;
+		}
+		return ret;
+	}
+
 	/**
 	 * Find the start position of a sub-string in *this.
 	 * @param substring
@@ -47,8 +47,11 @@ namespace bio {
  * The Mode of a String is set depending on how it is constructed. <br />
  * You may change the String::Mode using the static SetMode method, which will produce a new String. <br />
  * A READ_ONLY String cannot be set by any means. If you wish to edit a READ_ONLY String, you must SetMode first. <br />
- * A COPY_ON_WRITE String will automatically become a READ_WRITE String when written to. <br />
- * NOTE: There are no "WRITE" operation for COPY_ON_WRITE to use. This will likely change in a future release. <br />
+ * A COPY_ON_WRITE String will automatically become a READ_WRITE String when written to (i.e. when GetWritableString() is called). <br />
+ * <br />
+ * Strings which own their contents (i.e. all READ_WRITE Strings and COPY_ON_WRITE Strings made from them) keep them in a reference counted buffer. <br />
+ * Copying such a String shares that buffer instead of cloning it. The buffer is only cloned when a String which shares it is written to. <br />
+ * Because Containers and ByteStreams memcpy what they store, Strings never point into themselves (i.e. there is no small string buffer). <br />
  */
 class String : public ImmutableString
 {
@@ -57,7 +60,7 @@ public:
 	typedef enum {
 		INVALID = 0,
 		READ_ONLY,
-		COPY_ON_WRITE, //TODO
+		COPY_ON_WRITE,
 		READ_WRITE,
 		MODE_MAX
 	} Mode;
@@ -75,7 +78,8 @@ public:
 	 * In order to change the Mode of a String, you must create a new String. <br />
 	 * UNDEFINED BEHAVIOR if you: <br />
 	 * 1. create a READ_ONLY version of a READ_WRITE String and the source string becomes inaccessible. <br />
-	 * 2. create a COPY_ON_WRITE String which does not become READ_WRITE before the source string becomes inaccessible. <br />
+	 * 2. create a COPY_ON_WRITE String from a String which does not own its contents and the source string becomes inaccessible before the result is written to. <br />
+	 * A READ_WRITE or COPY_ON_WRITE String made from a String which owns its contents shares them, rather than cloning them. <br />
 	 * @param string
 	 * @param desiredMode
 	 * @return a new String with the desiredMode or a String(), if the desiredMode is not valid.
@@ -101,7 +105,7 @@ public:
 	 * std::strings can only ever READ_WRITE, since their c_str() method goes out of scope on subsequent access. <br />
 	 * @param string
 	 */
-	String(::std::string string);
+	String(const ::std::string& string);
 
 	/**
 	 * ImmutableStrings are treated as const char* and will yield a READ_ONLY String. <br />
@@ -110,15 +114,17 @@ public:
 	String(const ImmutableString& string);
 
 	/**
+	 * If toCopy owns its contents, they are shared with *this rather than cloned. <br />
 	 * @param toCopy
 	 */
 	String(const String& toCopy);
 
 	#if BIO_CPP_VERSION >= 11
 	/**
+	 * Takes the contents of toMove, leaving it empty. <br />
 	 * @param toMove
 	 */
-	String(const String&& toMove);
+	String(String&& toMove);
 	#endif
 
 	virtual ~String();
@@ -137,14 +143,16 @@ public:
 
 	#if BIO_CPP_VERSION >= 11
 	/**
+	 * Takes the contents of toMove, leaving it empty. <br />
 	 * NOTE: Mode is moved.
 	 * @param toMove
 	 * @return *this.
 	 */
-	virtual String& operator=(const String&& toMove);
+	virtual String& operator=(String&& toMove);
 	#endif
 
 	/**
+	 * If toCopy owns its contents, they are shared with *this rather than cloned. <br />
 	 * NOTE: Mode is NOT copied.
 	 * @param toCopy
 	 * @return *this.
@@ -154,7 +162,8 @@ public:
 	/**
 	 * This is just lies: we const_cast(this) and change the values.. <br />
 	 * This is used in places where a move operation would be performed but since that can't be done prior to c++11, we hack it. <br />
-	 * All Values are moved, including Mode,
+	 * All Values are moved, including Mode. <br />
+	 * toMoveHack is left untouched, so if it owns its contents, they are shared with *this. <br />
 	 * @param toMoveHack
 	 * @return *this.
 	 */
@@ -177,7 +186,7 @@ public:
 	 * @param string
 	 * @return *this.
 	 */
-	virtual String& operator=(::std::string string);
+	virtual String& operator=(const ::std::string& string);
 
 	/**
 	 * NOTE: We ignore Mode when comparing Strings.
@@ -205,6 +214,14 @@ public:
 	 */
 	virtual bool operator==(const ::std::string& other) const;
 
+	/**
+	 * Case insensitive operator==. <br />
+	 * NOTE: We ignore Mode when comparing Strings.
+	 * @param other
+	 * @return whether or not the contents of *this match those of other, ignoring case.
+	 */
+	virtual bool IsEqualInsensitive(const ImmutableString& other) const;
+
 	/**
 	 * @return *this as an std::string.
 	 */
@@ -222,6 +239,20 @@ public:
 	 */
 	virtual Mode GetMode() const;
 
+	/**
+	 * @return whether or not the contents of *this are owned by more than 1 String.
+	 */
+	virtual bool IsShared() const;
+
+	/**
+	 * Writing to a String is done through the pointer returned here. <br />
+	 * If the contents of *this are shared or not owned by *this, they are cloned first, so that no other String is changed. <br />
+	 * A COPY_ON_WRITE String becomes READ_WRITE. <br />
+	 * NOTE: the returned pointer is only valid until *this is next assigned, copied from, or destroyed. <br />
+	 * @return the contents of *this, which may be changed (but not lengthened); NULL if *this is READ_ONLY or empty.
+	 */
+	virtual char* GetWritableString();
+
 	/**
 	 * Get a smaller string from *this. <br />
 	 * @param start
@@ -272,10 +303,31 @@ public:
 
 
 protected:
+	/**
+	 * The reference counted buffer owned contents are kept in. <br />
+	 * See String.cpp. <br />
+	 */
+	struct Share;
+
 	Mode mMode;
+	Share* mShare;
+
+	/**
+	 * Replaces the contents of *this with a new buffer, owned only by *this, which holds a copy of source. <br />
+	 * @param source
+	 * @param length
+	 */
+	void Own(const char* source, ::std::size_t length);
+
+	/**
+	 * Replaces the contents of *this with those of other. <br />
+	 * If other owns its contents, they are shared with *this. Otherwise, *this points to the same string as other. <br />
+	 * @param other
+	 */
+	void ShareWith(const String& other);
 
 	/**
-	 * Will delete mString if *this is READ_WRITE, etc. <br />
+	 * Will release the contents of *this, if *this owns them, deleting them if no other String shares them. <br />
 	 */
 	virtual void Clear();
 };
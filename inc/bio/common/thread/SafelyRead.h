@@ -0,0 +1,93 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2022 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "bio/common/macro/Macros.h"
+
+/**
+ * SafelyRead<> is the const counterpart of SafelyAccess<>. <br />
+ * Rather than locking the wrapped object exclusively, SafelyRead<> takes a shared lock, so that many threads may read the same object at once (when BIO_THREAD_LOCK_POLICY is BIO_THREAD_LOCK_POLICY_SHARED; otherwise, this is the same as SafelyAccess<>). <br />
+ * Only const access is provided. <br />
+ * If you don't supply the object to wrap, we assume it's a bio::Singleton with an Instance() method. <br />
+ * @tparam CLASS a child of bio::ThreadSafe.
+ */
+template < class CLASS >
+class SafelyRead
+{
+public:
+	/**
+	 * Constructor for Singletons. <br />
+	 */
+	SafelyRead() :
+		mClass(&CLASS::Instance())
+	{
+		this->CommonConstructor();
+	}
+
+	/**
+	 * Constructor for all other ThreadSafe objects. <br />
+	 * @param toRead
+	 */
+	SafelyRead(const CLASS* toRead) :
+		mClass(toRead)
+	{
+		this->CommonConstructor();
+	}
+
+	/**
+	 * Release RAII lock. <br />
+	 */
+	~SafelyRead()
+	{
+		this->mClass->UnlockThreadShared();
+	}
+
+	/**
+	 * Access the locked object. <br />
+	 * @return a pointer to the locked CLASS.
+	 */
+	const CLASS* operator->() const
+	{
+		return this->mClass;
+	}
+
+	/**
+	 * Access the locked object. <br />
+	 * @return a pointer to the locked CLASS.
+	 */
+	const CLASS* operator*() const
+	{
+		return mClass;
+	}
+
+private:
+	const CLASS* mClass;
+
+	void CommonConstructor()
+	{
+		BIO_ASSERT(this->mClass)
+		this->mClass->LockThreadShared();
+	}
+
+	//remove copy ctors.
+	SafelyRead(SafelyRead const &);
+	void operator=(SafelyRead const &);
+};
@@ -0,0 +1,162 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2022 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "ThreadSafe.h"
+#include "bio/common/container/common/Types.h"
+#include "bio/common/macro/Macros.h"
+#include "bio/common/macro/SingletonMacros.h"
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace bio {
+
+/**
+ * ParallelWork is anything that can be split up by Index and done on several threads at once. <br />
+ * Work(i) will be called exactly once for every i in [0, count) given to ThreadPool::Distribute(). <br />
+ * The order and thread of those calls is not defined, so Work() must not depend on any other Index. <br />
+ */
+class ParallelWork
+{
+public:
+	/**
+	 *
+	 */
+	virtual ~ParallelWork()
+	{
+	}
+
+	/**
+	 * Do the work for the given index. <br />
+	 * @param index
+	 */
+	virtual void Work(const Index index) = 0;
+};
+
+/**
+ * A ThreadPool runs ParallelWork on a fixed set of Threaded workers. <br />
+ * Each worker keeps its own queue of chunks of work. Workers take work from the back of their own queues and, when they run out, steal from the front of the queues of other workers. <br />
+ * Workers which find nothing to steal sleep until more work is Distribute()d, so an idle ThreadPool costs nothing. <br />
+ * A thread which Distribute()s work helps do that work until it is all done. So, Distribute() may be called from within ParallelWork (i.e. nested parallelism is okay). <br />
+ *
+ * If thread safety is disabled (see BIO_THREAD_ENFORCEMENT_LEVEL), or *this has no workers, all work is done on the calling thread. <br />
+ *
+ * Please use ThreadPool::Instance() rather than making your own. <br />
+ */
+class ThreadPoolImplementation :
+	virtual public ThreadSafe
+{
+public:
+
+	/**
+	 *
+	 */
+	ThreadPoolImplementation();
+
+	/**
+	 * Stop()s *this. <br />
+	 */
+	virtual ~ThreadPoolImplementation();
+
+	/**
+	 * Create and start the given number of workers. <br />
+	 * Distribute() will Start() *this with the default number of workers, if it has not been started. <br />
+	 * Nop if *this has already been started; Stop() first to change the number of workers. <br />
+	 * @param numberOfWorkers how many threads to start, beyond whichever calls Distribute(); 0 means 1 less than the number of cores.
+	 * @return whether or not *this is now started.
+	 */
+	bool Start(Index numberOfWorkers = 0);
+
+	/**
+	 * Stop and delete all workers. <br />
+	 * Must not be called while any work is being Distribute()d. <br />
+	 */
+	void Stop();
+
+	/**
+	 * @return whether or not *this has been Start()ed.
+	 */
+	bool IsStarted() const;
+
+	/**
+	 * @return the number of worker threads in *this.
+	 */
+	Index GetNumberOfWorkers() const;
+
+	/**
+	 * Call work->Work(i) for every i in [0, count), across all workers, and wait until they have all been done. <br />
+	 * If any Work() throws, Distribute() will throw a ::std::runtime_error with the same message, after all other work is done. <br />
+	 * @param work
+	 * @param count
+	 */
+	void Distribute(
+		ParallelWork* work,
+		const Index count
+	);
+
+protected:
+	class Worker;
+	struct Job;
+	struct Parking;
+
+	/**
+	 * A range of Indices of a Job. <br />
+	 */
+	struct Chunk
+	{
+		Job* mJob;
+		Index mBegin;
+		Index mEnd;
+	};
+
+	/**
+	 * Take 1 Chunk and do it. <br />
+	 * @param self the Worker calling this or NULL if the caller is not a Worker of *this.
+	 * @return whether or not any work was done.
+	 */
+	bool DoChunk(Worker* self);
+
+	/**
+	 * Find a Chunk to do, first from self, then from the other Workers. <br />
+	 * @param self the Worker calling this or NULL if the caller is not a Worker of *this.
+	 * @param chunk where to put the found Chunk.
+	 * @return whether or not a Chunk was found.
+	 */
+	bool FindChunk(
+		Worker* self,
+		Chunk& chunk
+	);
+
+	/**
+	 * @return the Worker of *this that is calling this or NULL.
+	 */
+	Worker* GetCurrentWorker() const;
+
+	::std::vector< Worker* > mWorkers;
+	Parking* mParking;
+	bool mIsStarted;
+};
+
+BIO_SINGLETON(ThreadPool, ThreadPoolImplementation)
+
+} //bio namespace
@@ -24,13 +24,43 @@
 #include "bio/common/macro/Macros.h"
 
 //@formatter:off
-#if BIO_THREAD_ENFORCEMENT_LEVEL > 0
-	#if BIO_CPP_VERSION < 11
-		#ifdef BIO_OS_IS_LINUX
-			#include <pthread.h>
+#define BIO_THREAD_LOCK_WITH_NOTHING 0
+#define BIO_THREAD_LOCK_WITH_STD_MUTEX 1
+#define BIO_THREAD_LOCK_WITH_STD_ATOMIC_FLAG 2
+#define BIO_THREAD_LOCK_WITH_STD_SHARED_MUTEX 3
+#define BIO_THREAD_LOCK_WITH_PTHREAD_MUTEX 4
+#define BIO_THREAD_LOCK_WITH_PTHREAD_SPINLOCK 5
+#define BIO_THREAD_LOCK_WITH_PTHREAD_RWLOCK 6
+
+#if BIO_THREAD_ENFORCEMENT_LEVEL == 0
+	#define BIO_THREAD_LOCK_WITH BIO_THREAD_LOCK_WITH_NOTHING
+#elif BIO_CPP_VERSION < 11
+	#ifdef BIO_OS_IS_LINUX
+		#include <pthread.h>
+		#if BIO_THREAD_LOCK_POLICY == BIO_THREAD_LOCK_POLICY_SPIN
+			#define BIO_THREAD_LOCK_WITH BIO_THREAD_LOCK_WITH_PTHREAD_SPINLOCK
+		#elif BIO_THREAD_LOCK_POLICY == BIO_THREAD_LOCK_POLICY_SHARED
+			#define BIO_THREAD_LOCK_WITH BIO_THREAD_LOCK_WITH_PTHREAD_RWLOCK
+		#else
+			#define BIO_THREAD_LOCK_WITH BIO_THREAD_LOCK_WITH_PTHREAD_MUTEX
 		#endif
+	#else
+		#define BIO_THREAD_LOCK_WITH BIO_THREAD_LOCK_WITH_NOTHING
+	#endif
+#else
+	#include <atomic>
+	#include <thread>
+	#if BIO_THREAD_LOCK_POLICY == BIO_THREAD_LOCK_POLICY_SPIN
+		#define BIO_THREAD_LOCK_WITH BIO_THREAD_LOCK_WITH_STD_ATOMIC_FLAG
+	#elif BIO_THREAD_LOCK_POLICY == BIO_THREAD_LOCK_POLICY_SHARED && BIO_CPP_VERSION >= 14
+		#include <shared_mutex>
+		#define BIO_THREAD_LOCK_WITH BIO_THREAD_LOCK_WITH_STD_SHARED_MUTEX
+	#elif BIO_THREAD_LOCK_POLICY == BIO_THREAD_LOCK_POLICY_SHARED && defined(BIO_OS_IS_LINUX)
+		#include <pthread.h>
+		#define BIO_THREAD_LOCK_WITH BIO_THREAD_LOCK_WITH_PTHREAD_RWLOCK
 	#else
 		#include <mutex>
+		#define BIO_THREAD_LOCK_WITH BIO_THREAD_LOCK_WITH_STD_MUTEX
 	#endif
 #endif
 //@formatter:on
@@ -47,7 +77,11 @@ namespace bio {
  *
  * NOTE: if you do not need threading and don't want to waste time locking & unlocking a single thread all the time, check out Optimize.h (in bio/common), which will let you turn off threading for an extra performance boost (i.e. set BIO_THREAD_ENFORCEMENT_LEVEL to 0 to disable). <br />
  *
- * Please see SafelyAccess for an easy way to create external locks of ThreadSafe classes.
+ * The kind of lock used is chosen at compile time by BIO_THREAD_LOCK_POLICY (see OptimizeMacros.h). <br />
+ * With the shared policy, any number of threads may LockThreadShared() at once, so long as no thread has LockThread()ed. With every other policy, LockThreadShared() is the same as LockThread(). <br />
+ * At BIO_THREAD_ENFORCEMENT_LEVEL 2, a thread trying to lock a ThreadSafe object it has already locked (which would deadlock) or to unlock one it has not locked will fail sanitization. <br />
+ *
+ * Please see SafelyAccess for an easy way to create external locks of ThreadSafe classes and SafelyRead for shared, const locks.
  */
 class ThreadSafe
 {
@@ -89,34 +123,55 @@ public:
 	virtual ~ThreadSafe();
 
 	/**
-	 * uses const_cast to call LockThread(). <br />
+	 * Gain exclusive access to *this. <br />
 	 */
 	void LockThread() const;
 
 	/**
-	 * uses const_cast to call UnlockThread(). <br />
+	 * Release the exclusive access gained by LockThread(). <br />
 	 */
 	void UnlockThread() const;
 
+	/**
+	 * Gain access to *this which may be shared with other readers. <br />
+	 * Only const methods should be called while *this is locked this way. <br />
+	 */
+	void LockThreadShared() const;
+
+	/**
+	 * Release the access gained by LockThreadShared(). <br />
+	 */
+	void UnlockThreadShared() const;
+
+protected:
 	//@formatter:off
-	#if BIO_THREAD_ENFORCEMENT_LEVEL > 0
-		#if BIO_CPP_VERSION < 11
-			#ifdef BIO_OS_IS_LINUX
-				mutable pthread_mutex_t mLock;
-			#endif
+	#if BIO_THREAD_LOCK_WITH == BIO_THREAD_LOCK_WITH_STD_MUTEX
+		mutable ::std::mutex mMutex;
+	#elif BIO_THREAD_LOCK_WITH == BIO_THREAD_LOCK_WITH_STD_ATOMIC_FLAG
+		mutable ::std::atomic_flag mFlag;
+	#elif BIO_THREAD_LOCK_WITH == BIO_THREAD_LOCK_WITH_STD_SHARED_MUTEX
+		#if BIO_CPP_VERSION >= 17
+			mutable ::std::shared_mutex mMutex;
 		#else
-			std::mutex mMutex;
-			mutable ::std::unique_lock<std::mutex> mLock;
+			mutable ::std::shared_timed_mutex mMutex;
 		#endif
+	#elif BIO_THREAD_LOCK_WITH == BIO_THREAD_LOCK_WITH_PTHREAD_MUTEX
+		mutable pthread_mutex_t mLock;
+	#elif BIO_THREAD_LOCK_WITH == BIO_THREAD_LOCK_WITH_PTHREAD_SPINLOCK
+		mutable pthread_spinlock_t mLock;
+	#elif BIO_THREAD_LOCK_WITH == BIO_THREAD_LOCK_WITH_PTHREAD_RWLOCK
+		mutable pthread_rwlock_t mLock;
 	#endif
-	//@formatter:on
 
-	#if BIO_THREAD_ENFORCEMENT_LEVEL > 1
-	mutable bool mIsLocked;
+	#if BIO_THREAD_ENFORCEMENT_LEVEL > 1 && BIO_CPP_VERSION >= 11
+		mutable ::std::atomic< ::std::thread::id > mOwner;
 	#endif
+	//@formatter:on
 
 private:
 	void CommonConstructor();
+
+	void CommonDestructor();
 };
 
 } //bio namespace
@@ -0,0 +1,67 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2022 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "bio/common/macro/Macros.h"
+#include "bio/common/TransparentWrapper.h"
+
+//@formatter:off
+#if BIO_CPP_VERSION < 11
+	#include <stdint.h>
+#else
+	#include <cstdint>
+#endif
+//@formatter:on
+
+namespace bio {
+namespace type {
+
+/**
+ * Determines whether or not T is an Id, i.e. a TransparentWrapper around an unsigned integer, as made by BIO_ID. <br />
+ * Ids are handed out densely by their Perspectives, starting at 1, so they can be used as Indices. <br />
+ * This works through overload resolution, so it is usable in c++98 template arguments. <br />
+ * @tparam T
+ */
+template < typename T >
+struct IsIdImplementation
+{
+	static char Test(const TransparentWrapper< uint8_t >*);
+	static char Test(const TransparentWrapper< uint16_t >*);
+	static char Test(const TransparentWrapper< uint32_t >*);
+	static char Test(const TransparentWrapper< uint64_t >*);
+	static long Test(...);
+
+	static const bool sValue = sizeof(Test((T*)0)) == sizeof(char);
+};
+
+/**
+ * @tparam T
+ * @return whether or not T is an Id.
+ */
+template < typename T >
+BIO_CONSTEXPR bool IsId()
+{
+	return IsIdImplementation< T >::sValue;
+}
+
+} //type namespace
+} //bio namespace
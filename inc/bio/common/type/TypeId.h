@@ -0,0 +1,154 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2022 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "TypeName.h"
+
+namespace bio {
+namespace type {
+
+/**
+ * A TypeHash is the 64 bit FNV-1a hash of a TypeName. <br />
+ * Because it is a hash of the name (and not an address), it is the same across translation units and shared libraries. <br />
+ * TypeId< T >() == TypeName< T >().GetHash(), so TypeHashes may be used to look up types in Perspectives, which index their Names by the same hash. <br />
+ */
+typedef uint64_t TypeHash;
+
+/**
+ * Like WrappedTypeName but returns the raw symbol, so that it may be read at compile time. <br />
+ * ImmutableString cannot be used in constant expressions, so TypeId must work on the characters directly. <br />
+ * @tparam T
+ * @return T as a c string with wrapping symbols.
+ */
+template < typename T >
+BIO_CONSTEXPR static const char* WrappedTypeSymbol()
+{
+	#ifdef __clang__
+	return __PRETTY_FUNCTION__;
+	#elif defined(__GNUC__)
+	return __PRETTY_FUNCTION__;
+	#elif defined(_MSC_VER)
+	return __FUNCSIG__;
+	#else
+		#error "Unsupported compiler"
+	#endif
+}
+
+/**
+ * strlen that may be used at compile time. <br />
+ * @param symbol
+ * @return the length of symbol.
+ */
+BIO_CONSTEXPR static ::std::size_t WrappedTypeSymbolLength(const char* symbol)
+{
+	::std::size_t ret = 0;
+	while (symbol[ret])
+	{
+		++ret;
+	}
+	return ret;
+}
+
+/**
+ * Used to trim leading characters from symbol string. <br />
+ * @return magic number for prefix length.
+ */
+BIO_CONSTEXPR static ::std::size_t WrappedTypeSymbolPrefixLength()
+{
+	const char* symbol = WrappedTypeSymbol< TypeNameProber >();
+	::std::size_t ret = 0;
+	while (symbol[ret])
+	{
+		if (symbol[ret] == 'v' && symbol[ret + 1] == 'o' && symbol[ret + 2] == 'i' && symbol[ret + 3] == 'd')
+		{
+			break;
+		}
+		++ret;
+	}
+	return ret;
+}
+
+/**
+ * Used to trim trailing characters from symbol string. <br />
+ * @return magic number for suffix length.
+ */
+BIO_CONSTEXPR static ::std::size_t WrappedTypeSymbolSuffixLength()
+{
+	return WrappedTypeSymbolLength(WrappedTypeSymbol< TypeNameProber >()) - WrappedTypeSymbolPrefixLength() - 4; //4 == strlen("void")
+}
+
+/**
+ * Hash the type portion of WrappedTypeSymbol< T >(). <br />
+ * This is the same algorithm as ImmutableString::GetHash(). <br />
+ * @tparam T
+ * @return the 64 bit FNV-1a hash of TypeName< T >().
+ */
+template < typename T >
+BIO_CONSTEXPR static TypeHash HashTypeName()
+{
+	const char* symbol = WrappedTypeSymbol< T >();
+	::std::size_t end = WrappedTypeSymbolLength(symbol) - WrappedTypeSymbolSuffixLength();
+	TypeHash ret = 14695981039346656037ULL;
+	for (
+		::std::size_t chr = WrappedTypeSymbolPrefixLength();
+		chr < end;
+		++chr
+		)
+	{
+		ret ^= TypeHash((unsigned char)symbol[chr]);
+		ret *= 1099511628211ULL;
+	}
+	return ret;
+}
+
+#if BIO_CPP_VERSION >= 14
+/**
+ * Forces HashTypeName< T >() to be evaluated at compile time. <br />
+ * @tparam T
+ */
+template < typename T >
+struct TypeIdImplementation
+{
+	static constexpr TypeHash sValue = HashTypeName< T >();
+};
+#endif
+
+/**
+ * Get a unique, constant id for T. <br />
+ * Comparing TypeIds is much faster than comparing TypeNames, which should only be needed for diagnostics. <br />
+ * In c++14 and beyond, this is computed at compile time. Before that, it is computed once per T. <br />
+ * @tparam T
+ * @return the TypeHash of T.
+ */
+template < typename T >
+BIO_CONSTEXPR inline TypeHash TypeId()
+{
+	#if BIO_CPP_VERSION >= 14
+	return TypeIdImplementation< T >::sValue;
+	#else
+	static const TypeHash sValue = HashTypeName< T >();
+	return sValue;
+	#endif
+}
+
+} //type namespace
+} //bio namespace
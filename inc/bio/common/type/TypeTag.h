@@ -0,0 +1,59 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2022 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "TypeName.h"
+
+namespace bio {
+namespace type {
+
+/**
+ * A TypeTag uniquely identifies a type by address, so types can be compared without comparing their TypeNames. <br />
+ * Calling a TypeTag gives the TypeName of the type it identifies. <br />
+ */
+typedef ImmutableString (*TypeTag)();
+
+/**
+ * Provides a single function per T, the address of which is the TypeTag for T. <br />
+ * @tparam T
+ */
+template < typename T >
+struct TypeTagImplementation
+{
+	static ImmutableString Name()
+	{
+		return TypeName< T >();
+	}
+};
+
+/**
+ * @tparam T
+ * @return the TypeTag for T.
+ */
+template < typename T >
+BIO_CONSTEXPR TypeTag GetTypeTag()
+{
+	return &TypeTagImplementation< T >::Name;
+}
+
+} //type namespace
+} //bio namespace
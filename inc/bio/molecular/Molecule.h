@@ -85,13 +85,14 @@ public:
 	/**
 	 * Standard ctors. <br />
 	 */
-	 BIO_DEFAULT_IDENTIFIABLE_CONSTRUCTORS(molecular,
+	 BIO_DEFAULT_IDENTIFIABLE_CONSTRUCTORS_WITH_COMMON_CONSTRUCTOR(molecular,
 		Molecule,
 		&MoleculePerspective::Instance(),
 		filter::Molecular())
 
 	/**
 	 * Copying a Molecule will duplicate all Surfaces of toCopy. <br />
+	 * If toCopy IsCopyOnWrite(), *this gets its own Surfaces, which share their Manage()d Waves with those of toCopy until they are written to. <br />
 	 * @param toCopy
 	 */
 	Molecule(const Molecule& toCopy);
@@ -351,6 +352,29 @@ public:
 	 * @return target
 	 */
 	virtual Molecule* operator>>(Molecule* target);
+
+	/**
+	 * Make all Surfaces of *this copy-on-write (or not). <br />
+	 * Surfaces Defined in *this after this call will inherit the setting. <br />
+	 * Copy-on-write Molecules can be Cloned in time proportional to their number of Surfaces, no matter how large the Surfaces' values are. <br />
+	 * See Surface::SetCopyOnWrite() for details. <br />
+	 * @param copyOnWrite
+	 */
+	virtual void SetCopyOnWrite(bool copyOnWrite);
+
+	/**
+	 * @return whether or not *this is copy-on-write.
+	 */
+	virtual bool IsCopyOnWrite() const;
+
+protected:
+	bool mCopyOnWrite;
+
+private:
+	/**
+	 * Common constructor code. <br />
+	 */
+	void CommonConstructor();
 };
 
 
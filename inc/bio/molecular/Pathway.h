@@ -24,6 +24,8 @@
 #include "bio/chemical/common/Class.h"
 #include "bio/chemical/reaction/Reaction.h"
 #include "bio/chemical/structure/motif/LinearMotif.h"
+#include "bio/common/thread/ThreadPool.h"
+#include <vector>
 
 namespace bio {
 namespace molecular {
@@ -70,10 +72,26 @@ public:
 	/**
 	 * The Process of a Pathway is the series of Reactions it includes. <br />
 	 * This is FIFO ordering (see class description for details). <br />
+	 * The Products of each step are handed to the next without Cloning any Substances, using Reactants which *this keeps for reuse. <br />
 	 * @param reactants
 	 * @return the Products from the last Reaction or a code::FailedReaction(), if any step did not succeed.
 	 */
-	virtual chemical::Products Process(chemical::Reactants* reactants);
+	virtual chemical::Products Process(chemical::Reactants* reactants) const;
+
+	/**
+	 * Process many independent sets of Reactants. <br />
+	 * The sets are spread across the ThreadPool, each running through every step of *this. <br />
+	 * Only use this if the Reactions in *this are safe to run on different Reactants at the same time. <br />
+	 * As with Reaction::ProcessEach(), NULL sets get a code::FailedReaction(). <br />
+	 * @param reactants the sets to Process; must hold count Reactants*.
+	 * @param count the number of sets.
+	 * @param products where to put the Products of each set; must have room for count Products.
+	 */
+	virtual void ProcessEach(
+		chemical::Reactants* const* reactants,
+		const Index count,
+		chemical::Products* products
+	) const;
 
 	/**
 	 * *this shouldn't have an Requirements / Reactants, so instead we check the first Reaction in *this. <br />
@@ -81,6 +99,48 @@ public:
 	 * @return whether or not the first Reaction in *this can use the given Substances.
 	 */
 	virtual bool ReactantsMeetRequirements(const chemical::Reactants* toCheck) const;
+
+protected:
+
+	/**
+	 * Run the given Reactions, in order, starting with reactants. <br />
+	 * The Products of each step are handed to the next through a Reactants from mReactantsPool. <br />
+	 * @param reactants
+	 * @param reactions the contents of *this, in the order they were added (i.e. from GatherContentsImplementation()), so that a Pathway of A then B runs A first.
+	 * @return the Products from the last Reaction or a code::FailedReaction(), if any step did not succeed.
+	 */
+	chemical::Products ProcessReactions(
+		chemical::Reactants* reactants,
+		const ::std::vector< chemical::Reaction* >& reactions
+	) const;
+
+	/**
+	 * For ProcessEach() on the ThreadPool. <br />
+	 */
+	class Batch :
+		public ParallelWork
+	{
+	public:
+		Batch(
+			const Pathway* pathway,
+			const ::std::vector< chemical::Reaction* >& reactions,
+			chemical::Reactants* const* reactants,
+			chemical::Products* products
+		);
+
+		virtual void Work(const Index index);
+
+		const Pathway* mPathway;
+		const ::std::vector< chemical::Reaction* >& mReactions;
+		chemical::Reactants* const* mReactants;
+		chemical::Products* mProducts;
+	};
+
+	/**
+	 * Reactants for handing Products from one step to the next. <br />
+	 * These are kept between calls to Process, so that their storage does not have to be reallocated. <br />
+	 */
+	mutable chemical::ReactantsPool mReactantsPool;
 };
 
 } //molecular namespace
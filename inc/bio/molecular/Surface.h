@@ -26,6 +26,9 @@
 #include "bio/molecular/common/Class.h"
 #include "bio/molecular/macro/Macros.h"
 #include "EnvironmentDependent.h"
+#include "bio/common/macro/PoolMacros.h"
+#include "bio/common/thread/ThreadSafe.h"
+#include <vector>
 
 namespace bio {
 namespace molecular {
@@ -49,6 +52,11 @@ public:
 	BIO_DISAMBIGUATE_ALL_CLASS_METHODS(molecular,
 		Surface)
 
+	/**
+	 * Molecules may Define and drop many Surfaces, so Surfaces are allocated from an ObjectPool; see PoolMacros.h. <br />
+	 */
+	BIO_POOLED(Surface)
+
 	/**
 	 * @param name
 	 */
@@ -59,8 +67,9 @@ public:
 
 	/**
 	 * Copying a Surface generates a new set of Molecules and will Clone any Manage()d Waves from toCopy into *this. <br />
+	 * If toCopy IsCopyOnWrite(), the Manage()d Waves are shared with toCopy instead of Cloned; see SetCopyOnWrite(). <br />
 	 * NOTE: all Use()d Waves will be lost. Since *this does not control what it Uses, it cannot (will not) duplicate it. <br />
-	 * Keep in mind that *this will delete all Managed Waves on destruction. <br />
+	 * Keep in mind that *this will delete all Managed Waves on destruction (unless they are still shared with another Surface). <br />
 	 * @param toCopy
 	 */
 	Surface(const Surface& toCopy);
@@ -100,6 +109,10 @@ public:
 			varPtr,
 			bond_type::Manage());
 		mBoundPosition = GetBondPosition< T >();
+		if (mCopyOnWrite)
+		{
+			ShareManagedBonds();
+		}
 		return Probe< T >();
 	}
 
@@ -126,6 +139,7 @@ public:
 	/**
 	 * Probe is the Biology style "get". <br />
 	 * This is a simple wrapper around Atom::As<>(). If you need to Get the T* *this is Bound to, use As directly. <br />
+	 * Because the returned T may be written to, Probe will Detach() *this from any Surfaces it shares Manage()d Waves with. As<>() does not, so treat the result of As<>() on a copy-on-write Surface as read only. <br />
 	 * @tparam T a non-pointer type that is Bound to *this.
 	 * @return a T that is Bound to *this or 0.
 	 */
@@ -137,6 +151,8 @@ public:
 		BIO_SANITIZE(mBoundPosition,,return 0)
 		BIO_SANITIZE(mBonds.IsAllocated(mBoundPosition),,return 0)
 
+		Detach();
+
 		//We won't bother re-implementing the Atom::As method here, even though we could be more efficient since we already know the Bonded position.
 
 		T* ret = this->As< T* >();
@@ -160,6 +176,7 @@ public:
 		BIO_STATIC_ASSERT(!type::IsPointer< T >());
 		if (mBoundPosition)
 		{
+			Detach();
 			T* bound = As< T* >();
 			*bound = toBind;
 		}
@@ -276,11 +293,105 @@ public:
 	 */
 	virtual physical::Waves operator--();
 
+	/**
+	 * Copy-on-write Surfaces share their Manage()d Waves with their copies, rather than Cloning them. <br />
+	 * This makes copying a Surface (and thus Cloning a Molecule full of Surfaces) cost a pointer copy per Manage()d Wave. <br />
+	 * The first write through Probe, Bind, Manage or Release will Detach() *this, giving it a private Clone of each Wave it was sharing. <br />
+	 * Turning copy-on-write off Detaches *this immediately. <br />
+	 * Copies of *this inherit this setting. <br />
+	 * @param copyOnWrite
+	 */
+	void SetCopyOnWrite(bool copyOnWrite);
+
+	/**
+	 * @return whether or not copies of *this will share their Manage()d Waves with *this.
+	 */
+	bool IsCopyOnWrite() const;
+
+	/**
+	 * @return whether or not *this currently shares any Manage()d Wave with another Surface.
+	 */
+	bool IsShared() const;
+
+	/**
+	 * Replace every Manage()d Wave *this shares with another Surface with a private Clone of that Wave. <br />
+	 * Nop if *this is not shared. <br />
+	 */
+	void Detach();
+
 protected:
+
+	/**
+	 * A Share counts the Surfaces which are Manage()ing the same Wave. <br />
+	 * The last Surface to Abandon a Share is responsible for deleting both the Wave and the Share. <br />
+	 */
+	class Share :
+		public ThreadSafe
+	{
+	public:
+		Share();
+
+		/**
+		 * Add a Surface to *this. <br />
+		 */
+		void Acquire();
+
+		/**
+		 * Remove a Surface from *this. <br />
+		 * @return the number of Surfaces still sharing *this.
+		 */
+		Index Abandon();
+
+		/**
+		 * If *this has more than 1 sharer, Clone the shared Wave and Abandon *this, all while holding *this, so that no other sharer can decide it is the sole owner (and start writing) before the Clone is complete. <br />
+		 * @param shared the Wave *this counts the sharers of.
+		 * @return a Clone of shared or NULL, if the caller is the sole owner of shared.
+		 */
+		physical::Wave* Fork(const physical::Wave* shared);
+
+		/**
+		 * @return the number of Surfaces sharing *this.
+		 */
+		Index GetNumberOfSharers() const;
+
+	protected:
+		Index mSharers;
+	};
+
+	/**
+	 * The Share of a single Manage()d Bond. <br />
+	 */
+	struct SharedBond
+	{
+		chemical::Valence mPosition;
+		Share* mShare;
+	};
+
+	/**
+	 * Create a Share for each Manage()d Bond which does not have one. <br />
+	 */
+	void ShareManagedBonds();
+
+	/**
+	 * @param position
+	 * @return the Share of the Bond at the given position or NULL.
+	 */
+	Share* GetShareAt(chemical::Valence position) const;
+
+	/**
+	 * Stop tracking the Share of the Bond at the given position. <br />
+	 * The Share is deleted if *this was its last sharer. The Bonded Wave is not touched. <br />
+	 * @param position
+	 */
+	void ForgetShareAt(chemical::Valence position);
+
 	/**
 	 * should be 0 or 1 in practice (i.e. we prevent >1 Binding).
 	 */
 	chemical::Valence mBoundPosition;
+
+	bool mCopyOnWrite;
+	::std::vector< SharedBond > mSharedBonds;
 };
 
 } //molecular namespace
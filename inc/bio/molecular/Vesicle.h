@@ -61,6 +61,7 @@ public:
 		filter::Molecular())
 
 	/**
+	 * Copies the Surfaces of toCopy as Molecule(const Molecule&) does, so a Vesicle which IsCopyOnWrite() gives its copy its own Pores. <br />
 	 * @param toCopy
 	 */
 	Vesicle(const Vesicle& toCopy);
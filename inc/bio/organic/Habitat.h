@@ -62,6 +62,7 @@ public:
 
 	/**
 	 * Causes each Organism to undergo Morphogenesis, after which, they will be ready to live here. <br />
+	 * Afterward, the PeriodicTable and SymmetryPerspective are put in read-mostly mode (see Perspective::SetReadMostly()), so that their Read...() lookups no longer lock. <br />
 	 */
 	virtual Code AdaptInhabitants();
 };
@@ -148,6 +148,26 @@ public:
 		this->Observer< Perspective< DIMENSION > >::SetPerspective(other.GetPerspective());
 	}
 
+	/**
+	 * Copies the Name, Id and Perspective of other, like the copy constructor. <br />
+	 * The Class (i.e. Wave) of *this is not assigned, so *this remains its own object. <br />
+	 * @param other
+	 * @return *this
+	 */
+	Identifiable& operator=(const Identifiable& other)
+	{
+		if (this == &other)
+		{
+			return *this;
+		}
+		#if BIO_MEMORY_OPTIMIZE_LEVEL < 1
+		mName = other.GetName();
+		#endif
+		mId = other.mId;
+		this->Observer< Perspective< DIMENSION > >::SetPerspective(other.GetPerspective());
+		return *this;
+	}
+
 	/**
 	 *
 	 */
@@ -300,9 +320,7 @@ public:
 	 */
 	virtual bool IsNameInsensitive(const Name& name) const
 	{
-		return !strcasecmp(
-			name.AsCharString(),
-			this->GetName().AsCharString());
+		return this->GetName().IsEqualInsensitive(name);
 	}
 
 	/**
@@ -28,12 +28,16 @@
 #include "bio/common/Cast.h"
 #include <sstream>
 #include <cstring>
+#include <vector>
+#include <utility>
+#include <new>
 
 //@formatter:off
 #if BIO_CPP_VERSION < 11
 	#include <stdint.h>
 #else
 	#include <cstdint>
+	#include <atomic>
 #endif
 //@formatter:on
 
@@ -65,6 +69,21 @@ struct PerspectiveUtilities
  * However, Neurons and Synapses share a lot of code and should exist within the same DIMENSION (e.g. in case you wanted to make some strange Neuron/Synapse hybrid). If your DIMENSION is a uint8_t, you could have 255 Neurons and 255 Synapses using a different Perspective for each. Using a single Respective, you could only have 255 uniquely identified Neurons OR Connections, total. <br />
  * Therefore, you'd likely want multiple Perspectives and a much larger DIMENSION (uint32_t, for instance) in order to accommodate a more total objects. <br />
  * See below for a macro for creating singleton of Perspectives. <br />
+ *
+ * Lookups are constant time: Names are indexed by their hash in an open-addressing table and, because Ids are handed out sequentially, each Id maps directly to the position of its Brane. <br />
+ * Branes are never removed from a Perspective, so neither index ever needs to be compacted. <br />
+ *
+ * Perspectives are usually accessed through SafelyAccess, which locks them for every lookup. <br />
+ * Once a Perspective has been populated, it will rarely change, so it may be put in a read-mostly mode with SetReadMostly(true). <br />
+ * In read-mostly mode, every change to *this publishes an immutable Snapshot, which the Read...() methods use without locking. <br />
+ * Writers must still lock *this (e.g. through SafelyAccess); the Read...() methods take a shared lock on their own if *this is not read-mostly. <br />
+ * Snapshots (and Wave types) replaced while in read-mostly mode are kept while any Read...() call may still be using them. <br />
+ * Each Read...() call counts itself as a reader of the current epoch. Each write which retires something starts a new epoch once no readers are left in the one before, then frees what was retired 2 epochs ago; see Retire(). <br />
+ * Thus, *this reclaims its own Snapshots and no more than 2 epochs of them are ever kept. ReclaimSnapshots() frees them all at once, but may only be called at a point the caller knows to be quiescent. <br />
+ * Read-mostly mode requires c++11 atomics. In c++98 builds, SetReadMostly() does nothing and the Read...() methods always lock. <br />
+ *
+ * Rather than registering the same Names on every run, a populated Perspective may be saved with WriteImage() and restored with ReadImage(), usually from a MappedFile. <br />
+ * Restored Ids are the same as those written, so anything which stored them remains valid. <br />
  */
 template < typename DIMENSION >
 class Perspective :
@@ -89,24 +108,145 @@ public:
 			:
 			mId(id),
 			mName(name),
+			mNameHash(name.GetHash()),
+			mType(type)
+		{
+		}
+
+		/**
+		 * For when the hash of name is already known (e.g. when restoring an image). <br />
+		 * @param id
+		 * @param name
+		 * @param nameHash must be name.GetHash().
+		 * @param type
+		 */
+		Brane(
+			Id id,
+			const Name& name,
+			uint64_t nameHash,
+			Wave* type
+		)
+			:
+			mId(id),
+			mName(name),
+			mNameHash(nameHash),
 			mType(type)
 		{
 		}
 
 		Id mId;
 		Name mName;
+		uint64_t mNameHash;
 		Wave* mType;
 	};
 
 	typedef Arrangement< Brane* > Branes;
 
+	/**
+	 * An immutable copy of the lookup tables of a Perspective. <br />
+	 * Branes themselves are shared, since their Ids and Names never change, but their types are copied, since those may be re-associated. <br />
+	 */
+	class Snapshot
+	{
+	public:
+		/**
+		 * Dense map of Id -> Brane.
+		 */
+		::std::vector< const Brane* > mBranes;
+
+		/**
+		 * Dense map of Id -> GetTypeFromId(), as of the creation of *this.
+		 */
+		::std::vector< const Wave* > mTypes;
+
+		/**
+		 * Dense map of Id -> Brane::mType, as of the creation of *this. <br />
+		 * This is only different from mTypes where a child of Perspective keeps something other than the type in its Branes (e.g. the Elements of the PeriodicTable). <br />
+		 */
+		::std::vector< const Wave* > mRecords;
+
+		/**
+		 * Copy of Perspective::mNameIndex.
+		 */
+		::std::vector< Id > mNameIndex;
+	};
+
+	/**
+	 * The start of an image written by WriteImage(). <br />
+	 * An image is laid out as: this header, an ImageBrane for every Id (in order), the type pool and the name pool. <br />
+	 * The name index is not part of an image; ReadImage() rebuilds it from the restored Names, so that a damaged image cannot make a Name unfindable or give it a second Id. <br />
+	 * Every section is a multiple of 8 bytes, so that an image may be used in place wherever it is 8 byte aligned (e.g. at the start of a MappedFile). <br />
+	 * All values are written in the byte order of the writer; images are meant to be reused by the same build on the same machine, not exchanged. <br />
+	 */
+	struct ImageHeader
+	{
+		uint32_t mMagic;
+		uint32_t mVersion;
+		uint64_t mSize;
+		uint64_t mNextId;
+		uint64_t mNumberOfBranes;
+		uint64_t mTypePoolSize;
+		uint64_t mNamePoolSize;
+	};
+
+	/**
+	 * The record of a single Brane in an image. <br />
+	 * Offsets are relative to the start of their pool. Names are followed by a '\0' in the name pool. <br />
+	 */
+	struct ImageBrane
+	{
+		uint64_t mId;
+		uint64_t mNameOffset;
+		uint64_t mNameLength;
+		uint64_t mTypeOffset;
+		uint64_t mTypeLength;
+	};
+
+	/**
+	 * @return the first 4 bytes of every image: "BIOP", when read in the byte order of the writer.
+	 */
+	static uint32_t ImageMagic()
+	{
+		return 0x504F4942;
+	}
+
+	/**
+	 * Change this whenever the image format changes. <br />
+	 * @return the version of images written by *this.
+	 */
+	static uint32_t ImageVersion()
+	{
+		return 2;
+	}
+
 	/**
 	 *
 	 */
 	Perspective()
 		:
-		mNextId(1)
+		mNextId(1),
+		mIsReadMostly(false),
+		mSnapshot(NULL),
+		mEpoch(0),
+		mNumReaders()
+	{
+	}
+
+	/**
+	 * Copies every Brane of toCopy, including Clone()s of their types. <br />
+	 * The copy is not read-mostly, regardless of toCopy. <br />
+	 * @param toCopy
+	 */
+	Perspective(const Perspective& toCopy)
+		:
+		ThreadSafe(toCopy),
+		mNextId(1),
+		mIsReadMostly(false),
+		mSnapshot(NULL),
+		mEpoch(0),
+		mNumReaders()
 	{
+		CopyBranesFrom(toCopy);
 	}
 
 	/**
@@ -114,23 +254,28 @@ public:
 	 */
 	virtual ~Perspective()
 	{
-		Brane* brane;
-		for (
-			SmartIterator brn = mBranes.Begin();
-			!brn.IsAfterEnd();
-			++brn
-			)
+		SetReadMostly(false);
+		ReclaimSnapshots();
+		DeleteBranes();
+	}
+
+	/**
+	 * Replaces the Branes of *this with copies of those in toCopy. <br />
+	 * *this will no longer be read-mostly. <br />
+	 * @param toCopy
+	 * @return *this.
+	 */
+	Perspective& operator=(const Perspective& toCopy)
+	{
+		if (this == &toCopy)
 		{
-			brane = brn;
-			if (brane->mType)
-			{
-				PerspectiveUtilities::Delete(brane->mType);
-				brane->mType = NULL;
-			}
-			delete brane;
-			brane = NULL;
+			return *this;
 		}
-		mBranes.Clear();
+		SetReadMostly(false);
+		ReclaimSnapshots();
+		DeleteBranes();
+		CopyBranesFrom(toCopy);
+		return *this;
 	}
 
 	/**
@@ -158,18 +303,11 @@ public:
 	 */
 	SmartIterator Find(const Id& id)
 	{
-		SmartIterator brn = mBranes.Begin();
-		for (
-			; !brn.IsAfterEnd();
-			++brn
-			)
+		SmartIterator brn(&mBranes, GetBraneIndex(id));
+		if (brn.GetIndex() == InvalidIndex())
 		{
-			if (brn.As< Brane* >()->mId == id)
-			{
-				return brn;
-			}
+			brn.Invalidate();
 		}
-		brn.Invalidate();
 		return brn;
 	}
 
@@ -180,21 +318,44 @@ public:
 	 */
 	SmartIterator Find(const Id& id) const
 	{
-		SmartIterator brn = mBranes.Begin();
-		for (
-			; !brn.IsAfterEnd();
-			++brn
-			)
+		SmartIterator brn(&mBranes, GetBraneIndex(id));
+		if (brn.GetIndex() == InvalidIndex())
 		{
-			if (brn.As< Brane* >()->mId == id)
-			{
-				return brn;
-			}
+			brn.Invalidate();
 		}
-		brn.Invalidate();
 		return brn;
 	}
 
+	/**
+	 * Faster than Find() when you don't need to iterate. <br />
+	 * @param id
+	 * @return the Brane for the given id or NULL.
+	 */
+	Brane* GetBraneFromId(const Id& id)
+	{
+		Index index = GetBraneIndex(id);
+		if (index == InvalidIndex())
+		{
+			return NULL;
+		}
+		return mBranes.OptimizedAccess(index);
+	}
+
+	/**
+	 * Faster than Find() when you don't need to iterate. <br />
+	 * @param id
+	 * @return the Brane for the given id or NULL.
+	 */
+	const Brane* GetBraneFromId(const Id& id) const
+	{
+		Index index = GetBraneIndex(id);
+		if (index == InvalidIndex())
+		{
+			return NULL;
+		}
+		return mBranes.OptimizedAccess(index);
+	}
+
 
 	/**
 	 * This will create a new Id for the given name if one does not exist. <br />
@@ -215,12 +376,21 @@ public:
 		}
 
 		ret = mNextId++;
-		mBranes.Add(
-			new Brane(
-				ret,
-				name,
-				NULL
-			));
+		Brane* brane = new Brane(
+			ret,
+			name,
+			NULL
+		);
+		Index index = mBranes.Add(brane);
+
+		::std::size_t position = ret;
+		if (mBraneIndices.size() <= position)
+		{
+			mBraneIndices.resize(position + 1, InvalidIndex());
+		}
+		mBraneIndices[position] = index;
+		IndexName(brane);
+		Republish();
 
 		return ret;
 	}
@@ -238,12 +408,12 @@ public:
 			return InvalidName();
 		}
 
-		SmartIterator result = Find(id);
-		if (!result.IsValid())
+		const Brane* brane = GetBraneFromId(id);
+		if (!brane)
 		{
 			return InvalidName();
 		}
-		return result.As< Brane* >()->mName;
+		return brane->mName;
 	}
 
 
@@ -292,21 +462,27 @@ public:
 			return InvalidId();
 		}
 
-		Brane* brane;
-		SmartIterator brn = mBranes.Begin();
-		for (
-			; !brn.IsAfterEnd();
-			++brn
-			)
-		{
-			brane = brn;
+		return FindInNameIndex(
+			mNameIndex,
+			this,
+			name
+		);
+	}
 
-			if (name == brane->mName)
-			{
-				return brane->mId;
-			}
-		}
-		return InvalidId();
+	/**
+	 * GetIdWithoutCreation() for a Name which has already been hashed (e.g. by type::TypeId()). <br />
+	 * No string comparison is done: with 64 bit hashes, a collision between the Names of one Perspective is not a practical concern. <br />
+	 * @param hash the ImmutableString::GetHash() of a Name.
+	 * @return the Id associated with the hashed Name else InvalidId().
+	 */
+	Id GetIdFromHash(const uint64_t hash) const
+	{
+		return FindInNameIndex(
+			mNameIndex,
+			this,
+			hash,
+			NULL
+		);
 	}
 
 	/**
@@ -331,16 +507,16 @@ public:
 		Wave* type
 	)
 	{
-		SmartIterator brn = Find(id);
-		if (!brn.IsValid())
+		Brane* brane = GetBraneFromId(id);
+		if (!brane)
 		{
 			return false;
 		}
-		Brane* brane = brn;
 
 		BIO_SANITIZE(type,
 			brane->mType = PerspectiveUtilities::Clone(type),
 			brane->mType = type)
+		Republish();
 
 		return true;
 	}
@@ -352,18 +528,25 @@ public:
 	 */
 	virtual bool DisassociateType(const Id& id)
 	{
-		SmartIterator brn = Find(id);
-		if (!brn.IsValid())
+		Brane* brane = GetBraneFromId(id);
+		if (!brane)
 		{
 			return false;
 		}
 
-		Brane* brane = brn;
-
-		BIO_SANITIZE_AT_SAFETY_LEVEL_1(brane->mType,
-			PerspectiveUtilities::Delete(brane->mType),
-		)
+		if (brane->mType && mIsReadMostly)
+		{
+			//Readers may still be using the old type.
+			mRetiredTypes.push_back(brane->mType);
+		}
+		else
+		{
+			BIO_SANITIZE_AT_SAFETY_LEVEL_1(brane->mType,
+				PerspectiveUtilities::Delete(brane->mType),
+			)
+		}
 		brane->mType = NULL;
+		Republish();
 
 		return true;
 	}
@@ -376,17 +559,17 @@ public:
 	 */
 	virtual const Wave* GetTypeFromId(const Id& id) const
 	{
-		BIO_SANITIZE(id == InvalidId(),
+		BIO_SANITIZE(id != InvalidId(),
 			,
 			return NULL
 		)
 
-		SmartIterator result = Find(id);
-		if (!result.IsValid())
+		const Brane* brane = GetBraneFromId(id);
+		if (!brane)
 		{
 			return NULL;
 		}
-		return result.As< Brane* >()->mType;
+		return brane->mType;
 	}
 
 	/**
@@ -425,73 +608,1056 @@ public:
 	}
 
 	/**
-	 * Ease of access method for casting the result of GetTypeFromId(). <br />
-	 * @tparam T
-	 * @param id
-	 * @return a T* associated with the given name id NULL.
+	 * Begin or end read-mostly mode. <br />
+	 * While read-mostly, every change to *this will copy the lookup tables into a new Snapshot, which is O(#Ids). <br />
+	 * So, only enable read-mostly mode once *this has been mostly populated. <br />
+	 * Like any other write, this should only be called while *this is locked. <br />
+	 * Before c++11, this does nothing: read-mostly mode is never entered and every read still takes the lock. <br />
+	 * @param readMostly
 	 */
-	template < typename T >
-	const T GetTypeFromIdAs(const Id& id) const
+	void SetReadMostly(bool readMostly)
 	{
-		BIO_STATIC_ASSERT(type::IsPointer< T >())
-		BIO_SANITIZE_WITH_CACHE(GetTypeFromId(id),
-			BIO_SINGLE_ARG(return ForceCast< T, const Wave* >(RESULT)),
-			return NULL
-		)
+		#if BIO_CPP_VERSION >= 11
+		mIsReadMostly = readMostly;
+		if (mIsReadMostly)
+		{
+			Republish();
+		}
+		else
+		{
+			Retire(mSnapshot.exchange(NULL, ::std::memory_order_seq_cst));
+		}
+		#else
+		(void)readMostly;
+		#endif
 	}
 
 	/**
-	 * Ease of access method for casting the result of GetTypeFromId(). <br />
-	 * @tparam T
-	 * @param name
-	 * @return a T* associated with the given name id NULL.
+	 * @return whether or not *this is publishing Snapshots for the Read...() methods.
 	 */
-	template < typename T >
-	const T GetTypeFromNameAs(const Name& name) const
+	bool IsReadMostly() const
 	{
-		BIO_STATIC_ASSERT(type::IsPointer< T >())
-		BIO_SANITIZE_WITH_CACHE(GetTypeFromName(name),
-			BIO_SINGLE_ARG(return ForceCast< T, const Wave* >(RESULT)),
-			return NULL
-		)
+		return mIsReadMostly;
 	}
 
 	/**
-	 * Ease of use method for casting the result of GetNewObjectFromId() <br />
-	 * @tparam T
-	 * @param id
-	 * @return a new T* from Clone()ing the type associated with the given id else NULL.
+	 * Deletes the Snapshots and types which have been replaced and not yet freed by Retire(). <br />
+	 * This is only safe when no thread is in the middle of a Read...() call on *this (i.e. at a quiescent point). <br />
+	 * Like any other write, this should only be called while *this is locked. <br />
 	 */
-	template < typename T >
-	T GetNewObjectFromIdAs(const Id& id)
+	void ReclaimSnapshots()
 	{
-		BIO_STATIC_ASSERT(type::IsPointer< T >())
-		BIO_SANITIZE_WITH_CACHE(GetNewObjectFromId(id),
-			BIO_SINGLE_ARG(return ForceCast< T, Wave* >(RESULT)),
-			return NULL
-		)
+		DeleteRetired(
+			mExpiringSnapshots,
+			mExpiringTypes
+		);
+		DeleteRetired(
+			mRetiredSnapshots,
+			mRetiredTypes
+		);
 	}
 
 	/**
-	 * Ease of access method for casting the result of GetNewObjectFromName() <br />
-	 * @tparam T
-	 * @param name
-	 * @return a new T* from Clone()ing the type associated with the given name else NULL.
+	 * Append an image of *this to the given buffer. <br />
+	 * The image holds the Name and Id of every Brane and whatever WriteTypeImage() records for each type. <br />
+	 * Several images (e.g. of different Perspectives) may be appended to the same buffer and written to a single file; see ReadImage(). <br />
+	 * Like any other access, this should only be called while *this is locked. <br />
+	 * @param image
 	 */
-	template < typename T >
-	T GetNewObjectFromNameAs(const Name& name)
+	void WriteImage(::std::vector< unsigned char >& image) const
 	{
-		BIO_STATIC_ASSERT(type::IsPointer< T >())
-		BIO_SANITIZE_WITH_CACHE(GetNewObjectFromName(name),
-			BIO_SINGLE_ARG(return ForceCast< T, Wave* >(RESULT)),
-			return NULL
-		)
+		::std::size_t numberOfBranes = GetNumUsedIds();
+		::std::vector< unsigned char > typePool;
+		::std::vector< char > namePool;
+		::std::vector< ImageBrane > records(numberOfBranes);
+		const Brane* brane;
+		for (
+			::std::size_t position = 1;
+			position <= numberOfBranes;
+			++position
+			)
+		{
+			brane = GetBraneFromId(Id(position));
+			ImageBrane& record = records[position - 1];
+			record.mId = position;
+			record.mNameOffset = namePool.size();
+			record.mNameLength = brane->mName.Length();
+			namePool.insert(
+				namePool.end(),
+				brane->mName.GetCharacters(),
+				brane->mName.GetCharacters() + brane->mName.Length());
+			namePool.push_back('\0');
+
+			record.mTypeOffset = typePool.size();
+			WriteTypeImage(
+				brane,
+				typePool
+			);
+			record.mTypeLength = typePool.size() - record.mTypeOffset;
+			typePool.resize(PadImageSize(typePool.size()), 0);
+		}
+		namePool.resize(PadImageSize(namePool.size()), '\0');
+
+		ImageHeader header;
+		::std::memset(
+			&header,
+			0,
+			sizeof(header));
+		header.mMagic = ImageMagic();
+		header.mVersion = ImageVersion();
+		header.mNextId = numberOfBranes + 1;
+		header.mNumberOfBranes = numberOfBranes;
+		header.mTypePoolSize = typePool.size();
+		header.mNamePoolSize = namePool.size();
+		header.mSize = sizeof(ImageHeader) + numberOfBranes * sizeof(ImageBrane) + header.mTypePoolSize + header.mNamePoolSize;
+
+		::std::size_t start = image.size();
+		image.resize(start + header.mSize);
+		unsigned char* write = &image[start];
+		::std::memcpy(
+			write,
+			&header,
+			sizeof(header));
+		write += sizeof(header);
+		if (numberOfBranes)
+		{
+			::std::memcpy(
+				write,
+				&records[0],
+				numberOfBranes * sizeof(ImageBrane));
+			write += numberOfBranes * sizeof(ImageBrane);
+		}
+		if (!typePool.empty())
+		{
+			::std::memcpy(
+				write,
+				&typePool[0],
+				typePool.size());
+			write += typePool.size();
+		}
+		if (!namePool.empty())
+		{
+			::std::memcpy(
+				write,
+				&namePool[0],
+				namePool.size());
+		}
 	}
 
+	/**
+	 * Restore the Branes recorded by WriteImage(), keeping their Ids. <br />
+	 * This is meant to replace replaying all the GetIdFromName() calls (and the like) which populated the Perspective that wrote the image, e.g. at startup. <br />
+	 * The Names of restored Branes point into image, rather than being copied, and all restored Branes are allocated at once. So, image MUST outlive *this (e.g. by keeping the MappedFile image came from open) and must be 8 byte aligned. <br />
+	 * Types are not restored, except as ReadTypeImage() allows. <br />
+	 *
+	 * *this may already have Names (e.g. from static initialization), but each must have the same Id in image. Otherwise, the Ids in image would no longer be valid and nothing is restored. <br />
+	 * Likewise, nothing is restored from an image which was written by a different version of *this or which is damaged. <br />
+	 * Like any other write, this should only be called while *this is locked. <br />
+	 * @param image the start of an image written by WriteImage().
+	 * @param size the number of bytes available at image.
+	 * @param read if not NULL, will be set to the number of bytes in the image, so that the next image in a buffer may be found.
+	 * @return whether or not image was restored.
+	 */
+	bool ReadImage(
+		const unsigned char* image,
+		::std::size_t size,
+		::std::size_t* read = NULL
+	)
+	{
+		BIO_SANITIZE(image && size >= sizeof(ImageHeader) && !(reinterpret_cast< ::std::size_t >(image) % sizeof(uint64_t)), ,
+			return false)
 
-protected:
-	Branes mBranes;
-	Id mNextId;
+		//Images usually come from files, which may be stale or damaged, so the checks below do not depend on the BIO_SAFETY_LEVEL.
+		const ImageHeader* header = reinterpret_cast< const ImageHeader* >(image);
+		if (header->mMagic != ImageMagic() || header->mVersion != ImageVersion() || header->mSize > size)
+		{
+			return false;
+		}
+
+		const uint64_t numberOfBranes = header->mNumberOfBranes;
+		if (numberOfBranes > size / sizeof(ImageBrane) || header->mTypePoolSize > size || header->mNamePoolSize > size)
+		{
+			return false;
+		}
+		if (header->mSize != sizeof(ImageHeader) + numberOfBranes * sizeof(ImageBrane) + header->mTypePoolSize + header->mNamePoolSize)
+		{
+			return false;
+		}
+
+		//Every Id must fit in our DIMENSION.
+		if (header->mNextId != numberOfBranes + 1 || ::std::size_t(Id(::std::size_t(header->mNextId))) != header->mNextId)
+		{
+			return false;
+		}
+
+		const ImageBrane* records = reinterpret_cast< const ImageBrane* >(header + 1);
+		const unsigned char* typePool = reinterpret_cast< const unsigned char* >(records + numberOfBranes);
+		const char* namePool = reinterpret_cast< const char* >(typePool + header->mTypePoolSize);
+
+		//Nothing in the image is trusted beyond the Names themselves: we hash each and build our own name index, refusing any Name which appears twice.
+		::std::size_t nameIndexSize = 16;
+		while (nameIndexSize < 2 * numberOfBranes)
+		{
+			nameIndexSize *= 2;
+		}
+		::std::vector< Id > restoredNameIndex(
+			nameIndexSize,
+			InvalidId());
+		::std::vector< uint64_t > nameHashes(numberOfBranes);
+		for (
+			uint64_t position = 0;
+			position < numberOfBranes;
+			++position
+			)
+		{
+			const ImageBrane& record = records[position];
+			if (record.mId != position + 1 || record.mNameOffset >= header->mNamePoolSize || record.mNameLength >= header->mNamePoolSize - record.mNameOffset || namePool[record.mNameOffset + record.mNameLength] != '\0' || record.mTypeOffset > header->mTypePoolSize || record.mTypeLength > header->mTypePoolSize - record.mTypeOffset)
+			{
+				return false;
+			}
+			if (!IndexImageName(
+				restoredNameIndex,
+				records,
+				namePool,
+				nameHashes,
+				position))
+			{
+				return false;
+			}
+		}
+
+		//Make sure that every Name we already have keeps its Id.
+		::std::size_t numberOfExistingBranes = GetNumUsedIds();
+		if (numberOfExistingBranes > numberOfBranes)
+		{
+			return false;
+		}
+		const Brane* existing;
+		for (
+			::std::size_t position = 1;
+			position <= numberOfExistingBranes;
+			++position
+			)
+		{
+			existing = GetBraneFromId(Id(position));
+			const ImageBrane& record = records[position - 1];
+			if (!existing || existing->mName.Length() != record.mNameLength || ::std::memcmp(
+				existing->mName.GetCharacters(),
+				namePool + record.mNameOffset,
+				record.mNameLength))
+			{
+				return false;
+			}
+		}
+
+		::std::size_t numberOfNewBranes = numberOfBranes - numberOfExistingBranes;
+		if (numberOfNewBranes)
+		{
+			Brane* block = static_cast< Brane* >(::operator new(numberOfNewBranes * sizeof(Brane)));
+			mImageBlocks.push_back(::std::make_pair(
+				block,
+				numberOfNewBranes
+			));
+			mBranes.Reserve(mBranes.GetAllocatedSize() + numberOfNewBranes);
+			mBraneIndices.resize(numberOfBranes + 1, InvalidIndex());
+
+			Brane* brane;
+			for (
+				::std::size_t position = numberOfExistingBranes + 1;
+				position <= numberOfBranes;
+				++position
+				)
+			{
+				const ImageBrane& record = records[position - 1];
+				brane = new(block++) Brane(
+					Id(position),
+					Name(ImmutableString(
+						namePool + record.mNameOffset,
+						record.mNameLength
+					)),
+					nameHashes[position - 1],
+					NULL
+				);
+				mBraneIndices[position] = mBranes.Add(brane);
+			}
+
+			mNameIndex.swap(restoredNameIndex);
+			mNextId = Id(::std::size_t(header->mNextId));
+		}
+
+		for (
+			uint64_t position = 0;
+			position < numberOfBranes;
+			++position
+			)
+		{
+			const ImageBrane& record = records[position];
+			if (record.mTypeLength)
+			{
+				ReadTypeImage(
+					GetBraneFromId(Id(position + 1)),
+					typePool + record.mTypeOffset,
+					record.mTypeLength
+				);
+			}
+		}
+		Republish();
+
+		if (read)
+		{
+			*read = header->mSize;
+		}
+		return true;
+	}
+
+	/**
+	 * GetIdWithoutCreation() which does not lock *this, if *this IsReadMostly(). <br />
+	 * Do not call this while *this is locked by the same thread (e.g. through SafelyAccess). <br />
+	 * @param name
+	 * @return the Id associated with name else InvalidId().
+	 */
+	Id ReadIdWithoutCreation(const Name& name) const
+	{
+		::std::size_t reader;
+		const Snapshot* snapshot = AcquireSnapshot(reader);
+		if (!snapshot)
+		{
+			LockThreadShared();
+			Id ret = GetIdWithoutCreation(name);
+			UnlockThreadShared();
+			return ret;
+		}
+		Id ret = FindInNameIndex(
+			snapshot->mNameIndex,
+			snapshot,
+			name
+		);
+		ReleaseSnapshot(reader);
+		return ret;
+	}
+
+	/**
+	 * GetIdFromHash() which does not lock *this, if *this IsReadMostly(). <br />
+	 * Do not call this while *this is locked by the same thread (e.g. through SafelyAccess). <br />
+	 * @param hash the ImmutableString::GetHash() of a Name.
+	 * @return the Id associated with the hashed Name else InvalidId().
+	 */
+	Id ReadIdFromHash(const uint64_t hash) const
+	{
+		::std::size_t reader;
+		const Snapshot* snapshot = AcquireSnapshot(reader);
+		if (!snapshot)
+		{
+			LockThreadShared();
+			Id ret = GetIdFromHash(hash);
+			UnlockThreadShared();
+			return ret;
+		}
+		Id ret = FindInNameIndex(
+			snapshot->mNameIndex,
+			snapshot,
+			hash,
+			NULL
+		);
+		ReleaseSnapshot(reader);
+		return ret;
+	}
+
+	/**
+	 * GetNameFromId() which does not lock *this, if *this IsReadMostly(). <br />
+	 * Do not call this while *this is locked by the same thread (e.g. through SafelyAccess). <br />
+	 * @param id
+	 * @return the Name associated with the given Id
+	 */
+	Name ReadNameFromId(const Id& id) const
+	{
+		::std::size_t reader;
+		const Snapshot* snapshot = AcquireSnapshot(reader);
+		if (!snapshot)
+		{
+			LockThreadShared();
+			Name ret = GetNameFromId(id);
+			UnlockThreadShared();
+			return ret;
+		}
+		//Branes are never deleted while *this exists, so brane may be used after the Snapshot is released.
+		const Brane* brane = GetBraneFromSnapshot(
+			snapshot,
+			id
+		);
+		ReleaseSnapshot(reader);
+		if (!brane)
+		{
+			return InvalidName();
+		}
+		return brane->mName;
+	}
+
+	/**
+	 * GetTypeFromId() which does not lock *this, if *this IsReadMostly(). <br />
+	 * Do not call this while *this is locked by the same thread (e.g. through SafelyAccess). <br />
+	 * @param id
+	 * @return the pointer to the Wave type associated with the given id else NULL.
+	 */
+	const Wave* ReadTypeFromId(const Id& id) const
+	{
+		::std::size_t reader;
+		const Snapshot* snapshot = AcquireSnapshot(reader);
+		if (!snapshot)
+		{
+			LockThreadShared();
+			const Wave* ret = GetTypeFromId(id);
+			UnlockThreadShared();
+			return ret;
+		}
+		const Wave* ret = NULL;
+		if (GetBraneFromSnapshot(
+			snapshot,
+			id
+		))
+		{
+			ret = snapshot->mTypes[Id(id)];
+		}
+		ReleaseSnapshot(reader);
+		return ret;
+	}
+
+	/**
+	 * Ease of access method for casting the result of GetTypeFromId(). <br />
+	 * @tparam T
+	 * @param id
+	 * @return a T* associated with the given name id NULL.
+	 */
+	template < typename T >
+	const T GetTypeFromIdAs(const Id& id) const
+	{
+		BIO_STATIC_ASSERT(type::IsPointer< T >())
+		BIO_SANITIZE_WITH_CACHE(GetTypeFromId(id),
+			BIO_SINGLE_ARG(return ForceCast< T, const Wave* >(RESULT)),
+			return NULL
+		)
+	}
+
+	/**
+	 * Ease of access method for casting the result of GetTypeFromId(). <br />
+	 * @tparam T
+	 * @param name
+	 * @return a T* associated with the given name id NULL.
+	 */
+	template < typename T >
+	const T GetTypeFromNameAs(const Name& name) const
+	{
+		BIO_STATIC_ASSERT(type::IsPointer< T >())
+		BIO_SANITIZE_WITH_CACHE(GetTypeFromName(name),
+			BIO_SINGLE_ARG(return ForceCast< T, const Wave* >(RESULT)),
+			return NULL
+		)
+	}
+
+	/**
+	 * Ease of use method for casting the result of GetNewObjectFromId() <br />
+	 * @tparam T
+	 * @param id
+	 * @return a new T* from Clone()ing the type associated with the given id else NULL.
+	 */
+	template < typename T >
+	T GetNewObjectFromIdAs(const Id& id)
+	{
+		BIO_STATIC_ASSERT(type::IsPointer< T >())
+		BIO_SANITIZE_WITH_CACHE(GetNewObjectFromId(id),
+			BIO_SINGLE_ARG(return ForceCast< T, Wave* >(RESULT)),
+			return NULL
+		)
+	}
+
+	/**
+	 * Ease of access method for casting the result of GetNewObjectFromName() <br />
+	 * @tparam T
+	 * @param name
+	 * @return a new T* from Clone()ing the type associated with the given name else NULL.
+	 */
+	template < typename T >
+	T GetNewObjectFromNameAs(const Name& name)
+	{
+		BIO_STATIC_ASSERT(type::IsPointer< T >())
+		BIO_SANITIZE_WITH_CACHE(GetNewObjectFromName(name),
+			BIO_SINGLE_ARG(return ForceCast< T, Wave* >(RESULT)),
+			return NULL
+		)
+	}
+
+
+protected:
+	/**
+	 * Record whatever is needed to restore the type of brane in an image. <br />
+	 * Wave types cannot be written, so nothing is recorded by default. <br />
+	 * @param brane
+	 * @param typeImage append to this.
+	 */
+	virtual void WriteTypeImage(
+		const Brane* /*brane*/,
+		::std::vector< unsigned char >& /*typeImage*/
+	) const
+	{
+	}
+
+	/**
+	 * Restore the type of brane from what WriteTypeImage() recorded. <br />
+	 * brane may have been in *this before the image was read, in which case it may already have a type. <br />
+	 * @param brane
+	 * @param typeImage 8 byte aligned; points into the image given to ReadImage().
+	 * @param size the number of bytes written by WriteTypeImage(); never 0.
+	 */
+	virtual void ReadTypeImage(
+		Brane* /*brane*/,
+		const unsigned char* /*typeImage*/,
+		::std::size_t /*size*/
+	)
+	{
+	}
+
+	/**
+	 * @param size
+	 * @return size, rounded up to a multiple of 8 bytes.
+	 */
+	static ::std::size_t PadImageSize(::std::size_t size)
+	{
+		return (size + sizeof(uint64_t) - 1) / sizeof(uint64_t) * sizeof(uint64_t);
+	}
+
+	/**
+	 * @param brane
+	 * @return whether or not brane was allocated by ReadImage(), rather than with new.
+	 */
+	bool IsFromImage(const Brane* brane) const
+	{
+		for (
+			typename ::std::vector< ::std::pair< Brane*, ::std::size_t > >::const_iterator blk = mImageBlocks.begin();
+			blk != mImageBlocks.end();
+			++blk
+			)
+		{
+			if (brane >= blk->first && brane < blk->first + blk->second)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	 * @param id
+	 * @return the Index of the Brane for the given id in mBranes or InvalidIndex().
+	 */
+	Index GetBraneIndex(const Id& id) const
+	{
+		if (id == InvalidId())
+		{
+			return InvalidIndex();
+		}
+		//Id may be a TransparentWrapper, which only converts when non-const.
+		::std::size_t position = Id(id);
+		if (position >= mBraneIndices.size())
+		{
+			return InvalidIndex();
+		}
+		return mBraneIndices[position];
+	}
+
+	/**
+	 * Adds the given Brane to mNameIndex, growing it when more than half full. <br />
+	 * Assumes the name of brane is not already indexed. <br />
+	 * @param brane
+	 */
+	void IndexName(const Brane* brane)
+	{
+		::std::size_t used = GetNumUsedIds();
+		if (used * 2 > mNameIndex.size())
+		{
+			::std::size_t capacity = mNameIndex.empty() ? 16 : mNameIndex.size() * 2;
+			::std::vector< Id > oldIndex;
+			oldIndex.swap(mNameIndex);
+			mNameIndex.resize(capacity, InvalidId());
+			for (
+				typename ::std::vector< Id >::const_iterator old = oldIndex.begin();
+				old != oldIndex.end();
+				++old
+				)
+			{
+				if (*old != InvalidId())
+				{
+					InsertIntoNameIndex(GetBraneFromId(*old));
+				}
+			}
+		}
+		InsertIntoNameIndex(brane);
+	}
+
+	/**
+	 * Deletes all Branes in *this and their types. <br />
+	 */
+	void DeleteBranes()
+	{
+		Brane* brane;
+		for (
+			SmartIterator brn = mBranes.Begin();
+			!brn.IsAfterEnd();
+			++brn
+			)
+		{
+			brane = brn;
+			if (brane->mType)
+			{
+				PerspectiveUtilities::Delete(brane->mType);
+				brane->mType = NULL;
+			}
+			if (IsFromImage(brane))
+			{
+				brane->~Brane();
+			}
+			else
+			{
+				delete brane;
+			}
+			brane = NULL;
+		}
+		for (
+			typename ::std::vector< ::std::pair< Brane*, ::std::size_t > >::iterator blk = mImageBlocks.begin();
+			blk != mImageBlocks.end();
+			++blk
+			)
+		{
+			::operator delete(blk->first);
+		}
+		mImageBlocks.clear();
+		mBranes.Clear();
+		mBraneIndices.clear();
+		mNameIndex.clear();
+		mNextId = 1;
+	}
+
+	/**
+	 * Copies every Brane of toCopy into *this, including Clone()s of their types. <br />
+	 * *this should be empty. <br />
+	 * @param toCopy
+	 */
+	void CopyBranesFrom(const Perspective& toCopy)
+	{
+		mNextId = toCopy.mNextId;
+		mNameIndex = toCopy.mNameIndex;
+		mBraneIndices.assign(toCopy.mBraneIndices.size(), InvalidIndex());
+
+		const Brane* toClone;
+		Brane* brane;
+		for (
+			SmartIterator brn = toCopy.mBranes.Begin();
+			!brn.IsAfterEnd();
+			++brn
+			)
+		{
+			toClone = brn.As< Brane* >();
+			brane = new Brane(
+				toClone->mId,
+				toClone->mName,
+				toClone->mType ? PerspectiveUtilities::Clone(toClone->mType) : NULL
+			);
+			::std::size_t position = Id(brane->mId);
+			mBraneIndices[position] = mBranes.Add(brane);
+		}
+	}
+
+	/**
+	 * Probe the given name index for name. <br />
+	 * @tparam BRANES either *this or a Snapshot; anything which can be passed to GetBraneFromSnapshot().
+	 * @param nameIndex
+	 * @param branes
+	 * @param name
+	 * @return the Id associated with name else InvalidId().
+	 */
+	template < typename BRANES >
+	static Id FindInNameIndex(
+		const ::std::vector< Id >& nameIndex,
+		const BRANES* branes,
+		const Name& name
+	)
+	{
+		if (name == InvalidName())
+		{
+			return InvalidId();
+		}
+		return FindInNameIndex(
+			nameIndex,
+			branes,
+			name.GetHash(),
+			&name
+		);
+	}
+
+	/**
+	 * Probe the given name index for a Name which has already been hashed. <br />
+	 * @tparam BRANES either *this or a Snapshot; anything which can be passed to GetBraneFromSnapshot().
+	 * @param nameIndex
+	 * @param branes
+	 * @param hash the ImmutableString::GetHash() of the Name to find.
+	 * @param name if NULL, the first Brane with a matching hash is returned and no string comparison is done.
+	 * @return the Id associated with hash else InvalidId().
+	 */
+	template < typename BRANES >
+	static Id FindInNameIndex(
+		const ::std::vector< Id >& nameIndex,
+		const BRANES* branes,
+		const uint64_t hash,
+		const Name* name
+	)
+	{
+		if (nameIndex.empty())
+		{
+			return InvalidId();
+		}
+
+		::std::size_t mask = nameIndex.size() - 1;
+		const Brane* brane;
+		for (
+			::std::size_t slot = hash & mask;
+			nameIndex[slot] != InvalidId();
+			slot = (slot + 1) & mask
+			)
+		{
+			brane = GetBraneFromSnapshot(
+				branes,
+				nameIndex[slot]
+			);
+			if (brane->mNameHash == hash && (!name || *name == brane->mName))
+			{
+				return brane->mId;
+			}
+		}
+		return InvalidId();
+	}
+
+	/**
+	 * @param perspective
+	 * @param id
+	 * @return perspective->GetBraneFromId(id).
+	 */
+	static const Brane* GetBraneFromSnapshot(
+		const Perspective* perspective,
+		const Id& id
+	)
+	{
+		return perspective->GetBraneFromId(id);
+	}
+
+	/**
+	 * @param snapshot
+	 * @param id
+	 * @return the Brane for the given id in snapshot or NULL.
+	 */
+	static const Brane* GetBraneFromSnapshot(
+		const Snapshot* snapshot,
+		const Id& id
+	)
+	{
+		if (id == InvalidId())
+		{
+			return NULL;
+		}
+		::std::size_t position = Id(id);
+		if (position >= snapshot->mBranes.size())
+		{
+			return NULL;
+		}
+		return snapshot->mBranes[position];
+	}
+
+	/**
+	 * Counts the calling thread as a reader of the current epoch of *this, so that the Snapshot returned is not freed until ReleaseSnapshot(). <br />
+	 * The epoch is checked again after counting, so that a reader is never counted in an epoch which has already ended; see Retire(). <br />
+	 * @param reader set to what must be given to ReleaseSnapshot().
+	 * @return the current Snapshot or NULL, if *this is not read-mostly; ReleaseSnapshot() must be called iff this is not NULL.
+	 */
+	const Snapshot* AcquireSnapshot(::std::size_t& reader) const
+	{
+		#if BIO_CPP_VERSION >= 11
+		::std::size_t epoch = mEpoch.load(::std::memory_order_seq_cst);
+		while (true)
+		{
+			reader = epoch & 1;
+			mNumReaders[reader].fetch_add(1, ::std::memory_order_seq_cst);
+			::std::size_t current = mEpoch.load(::std::memory_order_seq_cst);
+			if (current == epoch)
+			{
+				break;
+			}
+			mNumReaders[reader].fetch_sub(1, ::std::memory_order_release);
+			epoch = current;
+		}
+		const Snapshot* ret = mSnapshot.load(::std::memory_order_seq_cst);
+		if (!ret)
+		{
+			ReleaseSnapshot(reader);
+		}
+		return ret;
+		#else
+		reader = 0;
+		return NULL;
+		#endif
+	}
+
+	/**
+	 * Stop counting the calling thread as a reader of *this. <br />
+	 * Nothing from the Snapshot given by AcquireSnapshot() may be used after this, except the Branes it points to. <br />
+	 * @param reader from AcquireSnapshot().
+	 */
+	void ReleaseSnapshot(::std::size_t reader) const
+	{
+		#if BIO_CPP_VERSION >= 11
+		mNumReaders[reader].fetch_sub(1, ::std::memory_order_release);
+		#else
+		(void)reader;
+		#endif
+	}
+
+	/**
+	 * Perspective::GetTypeFromId(), which does not lock *this, if *this IsReadMostly(). <br />
+	 * For children which keep something other than the type in their Branes, this gets that record rather than the type. <br />
+	 * Do not call this while *this is locked by the same thread (e.g. through SafelyAccess). <br />
+	 * @param id
+	 * @return the Brane::mType for the given id else NULL.
+	 */
+	const Wave* ReadRecordFromId(const Id& id) const
+	{
+		::std::size_t reader;
+		const Snapshot* snapshot = AcquireSnapshot(reader);
+		if (!snapshot)
+		{
+			LockThreadShared();
+			const Wave* ret = Perspective::GetTypeFromId(id);
+			UnlockThreadShared();
+			return ret;
+		}
+		const Wave* ret = NULL;
+		if (GetBraneFromSnapshot(
+			snapshot,
+			id
+		))
+		{
+			ret = snapshot->mRecords[Id(id)];
+		}
+		ReleaseSnapshot(reader);
+		return ret;
+	}
+
+	/**
+	 * If *this IsReadMostly(), publish a new Snapshot of *this. <br />
+	 * Call this after any change to the Branes of *this. <br />
+	 */
+	void Republish()
+	{
+		#if BIO_CPP_VERSION >= 11
+		if (!mIsReadMostly)
+		{
+			return;
+		}
+
+		Snapshot* snapshot = new Snapshot();
+		snapshot->mBranes.resize(mBraneIndices.size(), NULL);
+		snapshot->mTypes.resize(mBraneIndices.size(), NULL);
+		snapshot->mRecords.resize(mBraneIndices.size(), NULL);
+		snapshot->mNameIndex = mNameIndex;
+		const Brane* brane;
+		for (
+			::std::size_t position = 1;
+			position < mBraneIndices.size();
+			++position
+			)
+		{
+			if (mBraneIndices[position] == InvalidIndex())
+			{
+				continue;
+			}
+			brane = mBranes.OptimizedAccess(mBraneIndices[position]);
+			snapshot->mBranes[position] = brane;
+			snapshot->mTypes[position] = GetTypeFromId(brane->mId); //virtual, in case children store something other than the type in mType.
+			snapshot->mRecords[position] = brane->mType;
+		}
+
+		Retire(mSnapshot.exchange(snapshot, ::std::memory_order_seq_cst));
+		#endif
+	}
+
+	/**
+	 * Hold onto the given Snapshot until no Read...() call may be using it. <br />
+	 * This must be called after the Snapshot which replaces snapshot has been published. <br />
+	 * What is retired during an epoch is kept until the epoch after it ends. An epoch only ends once no readers are left in the epoch before it. <br />
+	 * Any reader which could have seen something retired 2 epochs ago was counted in one of those 2 epochs, and both have now been emptied. Readers of the new epoch can only find the latest Snapshot. <br />
+	 * @param snapshot may be NULL.
+	 */
+	void Retire(const Snapshot* snapshot)
+	{
+		if (snapshot)
+		{
+			mRetiredSnapshots.push_back(snapshot);
+		}
+		#if BIO_CPP_VERSION >= 11
+		if (mRetiredSnapshots.empty() && mRetiredTypes.empty())
+		{
+			return;
+		}
+		//Only writers change mEpoch, and they hold the lock.
+		::std::size_t epoch = mEpoch.load(::std::memory_order_relaxed);
+		if (mNumReaders[(epoch + 1) & 1].load(::std::memory_order_seq_cst))
+		{
+			//Someone is still reading the last epoch, so the next will have to wait.
+			return;
+		}
+		DeleteRetired(
+			mExpiringSnapshots,
+			mExpiringTypes
+		);
+		mExpiringSnapshots.swap(mRetiredSnapshots);
+		mExpiringTypes.swap(mRetiredTypes);
+		mEpoch.store(epoch + 1, ::std::memory_order_seq_cst);
+		#endif
+	}
+
+	/**
+	 * Delete and clear the given Snapshots and types. <br />
+	 * @param snapshots
+	 * @param types
+	 */
+	static void DeleteRetired(
+		::std::vector< const Snapshot* >& snapshots,
+		::std::vector< Wave* >& types
+	)
+	{
+		for (
+			typename ::std::vector< const Snapshot* >::iterator snp = snapshots.begin();
+			snp != snapshots.end();
+			++snp
+			)
+		{
+			delete *snp;
+		}
+		snapshots.clear();
+
+		for (
+			typename ::std::vector< Wave* >::iterator typ = types.begin();
+			typ != types.end();
+			++typ
+			)
+		{
+			PerspectiveUtilities::Delete(*typ);
+		}
+		types.clear();
+	}
+
+	/**
+	 * Places the Id of brane in the first open slot of mNameIndex, starting from its hash. <br />
+	 * mNameIndex must have at least 1 open slot. <br />
+	 * @param brane
+	 */
+	void InsertIntoNameIndex(const Brane* brane)
+	{
+		::std::size_t mask = mNameIndex.size() - 1;
+		::std::size_t slot = brane->mNameHash & mask;
+		while (mNameIndex[slot] != InvalidId())
+		{
+			slot = (slot + 1) & mask;
+		}
+		mNameIndex[slot] = brane->mId;
+	}
+
+	/**
+	 * Hash the Name of records[position] and place its Id in the first open slot of nameIndex, as InsertIntoNameIndex() would. <br />
+	 * nameIndex must have at least 1 open slot. <br />
+	 * For use while validating an image in ReadImage(), before any Branes exist for it. <br />
+	 * @param nameIndex the name index being built.
+	 * @param records the ImageBranes of the image.
+	 * @param namePool the name pool of the image.
+	 * @param nameHashes will have the hash of records[position] stored at position.
+	 * @param position
+	 * @return false if the Name of records[position] is already in nameIndex.
+	 */
+	static bool IndexImageName(
+		::std::vector< Id >& nameIndex,
+		const ImageBrane* records,
+		const char* namePool,
+		::std::vector< uint64_t >& nameHashes,
+		const uint64_t position
+	)
+	{
+		const ImageBrane& record = records[position];
+		const char* name = namePool + record.mNameOffset;
+		const uint64_t hash = ImmutableString(
+			name,
+			record.mNameLength
+		).GetHash();
+		nameHashes[position] = hash;
+
+		::std::size_t mask = nameIndex.size() - 1;
+		::std::size_t slot = hash & mask;
+		::std::size_t other;
+		while (nameIndex[slot] != InvalidId())
+		{
+			other = ::std::size_t(nameIndex[slot]) - 1;
+			if (nameHashes[other] == hash && records[other].mNameLength == record.mNameLength && !::std::memcmp(
+				namePool + records[other].mNameOffset,
+				name,
+				record.mNameLength))
+			{
+				return false;
+			}
+			slot = (slot + 1) & mask;
+		}
+		nameIndex[slot] = Id(::std::size_t(position + 1));
+		return true;
+	}
+
+	Branes mBranes;
+	Id mNextId;
+
+	/**
+	 * Dense map of Id -> Index in mBranes. Ids are allocated sequentially, so this never has gaps beyond the InvalidId() at 0. <br />
+	 */
+	::std::vector< Index > mBraneIndices;
+
+	/**
+	 * Open-addressing hash table of Name -> Id, probed linearly. <br />
+	 * The size is always a power of 2 and at most half the slots are used. <br />
+	 */
+	::std::vector< Id > mNameIndex;
+
+	bool mIsReadMostly;
+
+	//@formatter:off
+	#if BIO_CPP_VERSION >= 11
+		::std::atomic< const Snapshot* > mSnapshot;
+		::std::atomic< ::std::size_t > mEpoch;
+		mutable ::std::atomic< ::std::size_t > mNumReaders[2];
+	#else
+		const Snapshot* mSnapshot;
+		::std::size_t mEpoch;
+		::std::size_t mNumReaders[2];
+	#endif
+	//@formatter:on
+
+	/**
+	 * What was retired during the current epoch. <br />
+	 */
+	::std::vector< const Snapshot* > mRetiredSnapshots;
+	::std::vector< Wave* > mRetiredTypes;
+
+	/**
+	 * What was retired during the previous epoch, which is freed when the current epoch ends. <br />
+	 */
+	::std::vector< const Snapshot* > mExpiringSnapshots;
+	::std::vector< Wave* > mExpiringTypes;
+
+	/**
+	 * The blocks of Branes allocated by ReadImage() and how many Branes each holds. <br />
+	 */
+	::std::vector< ::std::pair< Brane*, ::std::size_t > > mImageBlocks;
 };
 
 } //physical namespace
@@ -22,10 +22,13 @@
 #pragma once
 
 #include "bio/physical/common/Class.h"
+#include "bio/physical/cache/CachedId.h"
 #include "Symmetry.h"
 #include "bio/physical/common/SymmetryTypes.h"
 #include "bio/common/macro/Macros.h"
+#include "bio/common/macro/PoolMacros.h"
 #include "bio/common/type/TypeName.h"
+#include "bio/common/thread/ThreadSafe.h"
 
 namespace bio {
 namespace physical {
@@ -34,7 +37,10 @@ namespace physical {
  * Quanta are simple Waves intended for built-in types. <br />
  * They allow anything to be treated as a Biological Wave. <br />
  * Iff you cannot derive from Wave, use Quantum<> instead. <br />
- * Each Quantum<T> will store a pointer to a T which it will new on creation and delete on destruction. <br />
+ * Each Quantum<T> stores its T inline, so creating a Quantum allocates nothing beyond the Quantum itself. <br />
+ * The Symmetry of a Quantum is only created when *this is first Spin()ed, and all Quantum<T>s share the same Symmetry Id. <br />
+ * Spin() locks a single ThreadSafe shared by all Quantum<T>s, so threads may Spin() the same Quantum at once: all get the same Symmetry and its value is written by one thread at a time. <br />
+ * The Symmetry returned is still shared, so reading it while another thread Spin()s the same Quantum is not safe. <br />
  * @tparam T
  */
 template < typename T >
@@ -49,17 +55,18 @@ public:
 	BIO_DISAMBIGUATE_ALL_CLASS_METHODS(physical,
 		Quantum< T >)
 
+	/**
+	 * Quanta are made for every Bond to a non-Wave, so they are allocated from an ObjectPool; see PoolMacros.h. <br />
+	 */
+	BIO_POOLED(Quantum< T >)
+
 	/**
 	 *
 	 */
 	Quantum()
 		:
-		physical::Class< Quantum< T > >(
-			this,
-			new Symmetry(
-				type::TypeName< T >(),
-				symmetry_type::DefineVariable())),
-		mQuantized(new T())
+		physical::Class< Quantum< T > >(this),
+		mQuantized()
 	{
 
 	}
@@ -69,12 +76,8 @@ public:
 	 */
 	Quantum(const T& assignment)
 		:
-		physical::Class< Quantum< T > >(
-			this,
-			new Symmetry(
-				type::TypeName< T >(),
-				symmetry_type::DefineVariable())),
-		mQuantized(new T(assignment))
+		physical::Class< Quantum< T > >(this),
+		mQuantized(assignment)
 	{
 	}
 
@@ -83,12 +86,8 @@ public:
 	 */
 	Quantum(const Quantum< T >& other)
 		:
-		physical::Class< Quantum< T > >(
-			this,
-			new Symmetry(
-				type::TypeName< T >(),
-				symmetry_type::DefineVariable())),
-		mQuantized(new T(other))
+		physical::Class< Quantum< T > >(this),
+		mQuantized(other.mQuantized)
 	{
 
 	}
@@ -98,7 +97,7 @@ public:
 	 */
 	virtual ~Quantum()
 	{
-		delete this->mQuantized;
+
 	}
 
 	/**
@@ -107,8 +106,7 @@ public:
 	 */
 	virtual T* GetQuantumObject()
 	{
-		BIO_SANITIZE(this->mQuantized,,return NULL)
-		return this->mQuantized;
+		return &this->mQuantized;
 	}
 
 	/**
@@ -117,8 +115,7 @@ public:
 	 */
 	virtual const T* GetQuantumObject() const
 	{
-		BIO_SANITIZE(this->mQuantized,,return NULL)
-		return this->mQuantized;
+		return &this->mQuantized;
 	}
 
 	/**
@@ -128,9 +125,7 @@ public:
 	 */
 	operator T&()
 	{
-		BIO_SANITIZE(mQuantized,
-			return *this->GetQuantumObject(),
-			return T());
+		return this->mQuantized;
 	}
 
 	/**
@@ -140,18 +135,29 @@ public:
 	 */
 	operator const T&() const
 	{
-		BIO_SANITIZE(mQuantized,
-			return *this->GetQuantumObject(),
-			return T());
+		return this->mQuantized;
 	}
 
 	/**
 	 * Required method from Wave. See that class for details. <br />
+	 * Creates the Symmetry of *this, if it does not yet exist. <br />
 	 * @return a Symmetrical image of *this
 	 */
 	virtual Symmetry* Spin() const
 	{
-		this->mSymmetry->AccessValue()->Set(*this->mQuantized);
+		//Creating our Symmetry doesn't change the value of *this.
+		Quantum< T >* self = const_cast< Quantum< T >* >(this);
+		Id symmetryId = GetSymmetryId(); //May lock the SymmetryPerspective, so we do this before taking our own lock.
+		ThreadSafe& lock = GetSpinLock();
+		lock.LockThread();
+		if (!self->mSymmetry)
+		{
+			self->mSymmetry = new Symmetry(
+				symmetryId,
+				symmetry_type::DefineVariable());
+		}
+		self->mSymmetry->AccessValue()->Set(this->mQuantized);
+		lock.UnlockThread();
 		return this->Wave::Spin();
 	}
 
@@ -165,12 +171,35 @@ public:
 		BIO_SANITIZE(symmetry, ,
 			return code::BadArgument1());
 		//Wave::Reify(symmetry); //this does nothing useful.
-		*this->mQuantized = symmetry->GetValue().As< T >();
+		this->mQuantized = symmetry->GetValue().As< T >();
 		return code::Success();
 	}
 
 protected:
-	T* mQuantized;
+	T mQuantized;
+
+	/**
+	 * Every Quantum< T > has the same Symmetry name, so we only look up its Id once. <br />
+	 * @return the Id of TypeName< T >() in the SymmetryPerspective.
+	 */
+	static Id GetSymmetryId()
+	{
+		static const Name sName = type::TypeName< T >(); //CachedId only holds a reference to its lookup.
+		static CachedId< Id > sId(
+			sName,
+			SymmetryPerspective::Instance());
+		return sId;
+	}
+
+	/**
+	 * Spin() is const, so it may be called by many threads at once, each of which would otherwise create and write the same Symmetry. <br />
+	 * @return the lock Spin() holds while creating and writing the Symmetry of any Quantum< T >.
+	 */
+	static ThreadSafe& GetSpinLock()
+	{
+		static ThreadSafe sLock;
+		return sLock;
+	}
 };
 
 } //physical namespace
@@ -24,6 +24,7 @@
 #include "bio/physical/common/Types.h"
 #include "Identifiable.h"
 #include "bio/common/ByteStream.h"
+#include "bio/common/macro/PoolMacros.h"
 
 namespace bio {
 namespace physical {
@@ -45,6 +46,11 @@ public:
 	BIO_DISAMBIGUATE_ALL_CLASS_METHODS(physical,
 		Symmetry)
 
+	/**
+	 * Every Spin() may create a Symmetry, so Symmetries are allocated from an ObjectPool; see PoolMacros.h. <br />
+	 */
+	BIO_POOLED(Symmetry)
+
 	/**
 	 *
 	 */
@@ -86,6 +92,52 @@ public:
 		SymmetryType type
 	);
 
+	/**
+	 * Copying a Symmetry does not consult any Perspective: the Id, Name and type of toCopy are taken as they are. <br />
+	 * This makes copying a previously constructed Symmetry much cheaper than constructing a new one from a Name. <br />
+	 * @param toCopy
+	 */
+	Symmetry(const Symmetry& toCopy);
+
+	/**
+	 * Copies the Id, Name, type and value of toCopy, like the copy constructor. <br />
+	 * *this remains its own Wave; nothing of the Wave of toCopy is taken. <br />
+	 * @param toCopy
+	 * @return *this
+	 */
+	Symmetry& operator=(const Symmetry& toCopy);
+
+	/**
+	 * Constructing a Symmetry from a Name requires looking that Name up in the SymmetryPerspective. <br />
+	 * When every object of a kind starts out with the same Symmetry (i.e. until it is Spin()ed), only the first needs that lookup. <br />
+	 * So, the first call for each PROTOTYPE constructs a prototype Symmetry and every call after that copies it, which costs one allocation and no Perspective lookups. <br />
+	 * If called with a different type than the first call, the new Symmetry is constructed in full. <br />
+	 * @tparam PROTOTYPE any type, used only to keep one prototype per kind of object; name should be the same for every call with the same PROTOTYPE.
+	 * @param name
+	 * @param type
+	 * @return a new Symmetry with the given name and type.
+	 */
+	template < typename PROTOTYPE >
+	static Symmetry* FromPrototype(
+		const Name& name,
+		SymmetryType type
+	)
+	{
+		static const Symmetry sPrototype(
+			name,
+			type
+		);
+
+		if (sPrototype.GetType().GetId() == type)
+		{
+			return new Symmetry(sPrototype);
+		}
+		return new Symmetry(
+			name,
+			type
+		);
+	}
+
 	/**
 	 *
 	 */
@@ -22,6 +22,7 @@
 #pragma once
 
 #include "bio/physical/common/Types.h"
+#include "bio/physical/cache/ResonanceTable.h"
 
 //@formatter:off
 #if BIO_CPP_VERSION < 11
@@ -87,6 +88,7 @@ public:
 	 * If we treat Properties as fourier components of a waveform, we could restate GetProperties as GetPeriodicComponents. In this context, "what a wave can do" and "what can be done with a wave" can be expressed as "which systems resonate with the wave in question" or "which systems have comparable periodic components", which is true here as well: when 2 Waves have the same Properties (i.e. Resonate with each other) they can be treated the same in some regard (perhaps they are "numeric" and can be "added") and when 2 waves have comparable properties, they can interact with each other. <br />
 	 * It is up to you and other users of this framework to determine which Properties to use where. This is your space, so make use of it when you feel it's appropriate. <br />
 	 * NOTE: Waves do not actually have mProperties. This method MUST be implemented by children in order to work. If using any chemical::Class or beyond, this method will be implemented for you. See chemical/Class.h for more info. <br />
+	 * NOTE: The result of this method is remembered for each type in the ResonanceTable. If you change what this returns for a type, you must Flush() the ResonanceTable. <br />
 	 * @return the Properties of *this (empty vector unless overridden).
 	 */
 	virtual Properties GetProperties() const;
@@ -121,6 +123,31 @@ public:
 		const Properties& properties
 	);
 
+	/**
+	 * Faster version of GetResonanceBetween(wave1, wave2).Size(). <br />
+	 * The Properties of each type of Wave are only gotten once; see ResonanceTable.h. <br />
+	 * @param wave1
+	 * @param wave2
+	 * @return whether or not the given Waves share any Property.
+	 */
+	static bool Resonates(
+		const Wave* wave1,
+		const Wave* wave2
+	);
+
+	/**
+	 * Faster version of GetResonanceBetween(wave, T::GetClassProperties()).Size(). <br />
+	 * Neither the Properties of wave's type nor those of T are gotten more than once; see ResonanceTable.h. <br />
+	 * @tparam T any class with a static GetClassProperties() method.
+	 * @param wave
+	 * @return whether or not wave shares any Property with T.
+	 */
+	template < typename T >
+	static bool ResonatesWithClass(const Wave* wave)
+	{
+		return ResonanceTable::Instance().GetSpectrumOf(wave).Overlaps(ResonanceTable::Instance().GetClassSpectrumOf< T >());
+	}
+
 	/**
 	 * Spinning a Wave produces a Symmetry. Waves can be Rotated about any number of Axes. <br />
 	 * Spinning a Wave along one dimension (one Axis) would be the equivalent of reflecting that Wave or, possibly, refracting, dispersing, or otherwise altering the wave (e.g. if the Axis acted like a prism, rather than a mirror). When a Wave is Spun around multiple dimensions, the resulting Symmetry and effected transformations may not fall under any single property characteristic of real waves. Thus we treat Waves more like particles with a discrete spin. <br />
@@ -64,11 +64,16 @@ public:
 	}
 
 	/**
-	 * Remove whatever *this has cached and re-look up the newest value.
+	 * Remove whatever *this has cached and re-look up the newest value. <br />
+	 * The lookup is first tried without locking the Perspective (see Perspective::ReadIdWithoutCreation()), since the Name has usually been seen before. <br />
 	 */
 	virtual void Flush()
 	{
-		this->mT = ((*SafelyAccess< physical::Perspective< ID_TYPE > >(&this->mPerspective))->*(this->mLookupFunction))(this->mLookup);
+		this->mT = this->mPerspective.ReadIdWithoutCreation(this->mLookup);
+		if (this->mT == physical::Perspective< ID_TYPE >::InvalidId())
+		{
+			this->mT = ((*SafelyAccess< physical::Perspective< ID_TYPE > >(&this->mPerspective))->*(this->mLookupFunction))(this->mLookup);
+		}
 	}
 
 	/**
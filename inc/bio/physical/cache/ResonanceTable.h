@@ -0,0 +1,305 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2022 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "bio/physical/common/Types.h"
+#include "bio/common/cache/AbstractCached.h"
+#include "bio/common/thread/ThreadSafe.h"
+#include "bio/common/macro/SingletonMacros.h"
+#include <vector>
+#include <typeinfo>
+
+//@formatter:off
+#if BIO_CPP_VERSION < 11
+	#include <stdint.h>
+#else
+	#include <cstdint>
+#endif
+//@formatter:on
+
+namespace bio {
+namespace physical {
+
+class Wave;
+
+/**
+ * A Spectrum is a set of Properties, stored as 1 bit per Property. <br />
+ * Because Properties are 8 bit Ids, a Spectrum is always 256 bits and never allocates. <br />
+ * Finding the Resonance between 2 Spectra is just an AND of 4 words. <br />
+ */
+class Spectrum
+{
+public:
+	typedef uint64_t Word;
+
+	/**
+	 * Makes an empty Spectrum. <br />
+	 */
+	Spectrum();
+
+	/**
+	 * @param properties the Properties to set in *this.
+	 */
+	explicit Spectrum(const Properties& properties);
+
+	/**
+	 * @param property
+	 */
+	inline void Set(const Property& property)
+	{
+		uint8_t bit = Property(property);
+		mWords[bit / sWordBits] |= Word(1) << (bit % sWordBits);
+	}
+
+	/**
+	 * @param property
+	 * @return whether or not the given Property is in *this.
+	 */
+	inline bool Has(const Property& property) const
+	{
+		uint8_t bit = Property(property);
+		return (mWords[bit / sWordBits] >> (bit % sWordBits)) & 1;
+	}
+
+	/**
+	 * @return whether or not *this has no Properties.
+	 */
+	inline bool IsEmpty() const
+	{
+		return !(mWords[0] | mWords[1] | mWords[2] | mWords[3]);
+	}
+
+	/**
+	 * @param other
+	 * @return the Properties in both *this and other.
+	 */
+	inline Spectrum operator&(const Spectrum& other) const
+	{
+		Spectrum ret;
+		for (
+			unsigned int wrd = 0;
+			wrd < sWordCount;
+			++wrd
+			)
+		{
+			ret.mWords[wrd] = mWords[wrd] & other.mWords[wrd];
+		}
+		return ret;
+	}
+
+	/**
+	 * @param other
+	 * @return whether or not *this and other share any Property.
+	 */
+	inline bool Overlaps(const Spectrum& other) const
+	{
+		return (mWords[0] & other.mWords[0]) | (mWords[1] & other.mWords[1]) | (mWords[2] & other.mWords[2]) | (mWords[3] & other.mWords[3]);
+	}
+
+	/**
+	 * @return the Properties in *this, in ascending order.
+	 */
+	Properties AsProperties() const;
+
+	static const unsigned int sWordBits = sizeof(Word) * 8;
+	static const unsigned int sWordCount = 256 / sWordBits;
+
+protected:
+	Word mWords[sWordCount];
+};
+
+/**
+ * The ResonanceTable remembers the Spectrum of each type of Wave, so that Wave::GetResonanceBetween() does not need to call GetProperties() (and build new Properties) every time. <br />
+ * Types are identified by their most derived type (i.e. typeid) and by which Wave within that type is asked, since a type may contain many Waves. <br />
+ * Both are stored with each Spectrum and compared on every lookup; their hash only decides where to look, since type hashes are not guaranteed to be unique. <br />
+ * This assumes that GetProperties() returns the same thing for every Wave of the same type, which is true for all Properties given by the PeriodicTable. <br />
+ *
+ * *this is registered with the GlobalCache, so GlobalCache::Flush() (or Flush()ing *this directly) will cause all Spectra to be gotten again. <br />
+ * The PeriodicTable Flush()es *this whenever it Records new Properties. <br />
+ * Spectra are built while *this is unlocked, so each Flush() starts a new generation and a Spectrum built before a Flush() is not Recorded after it. <br />
+ *
+ * Please use ResonanceTable::Instance() rather than making your own. <br />
+ */
+class ResonanceTableImplementation :
+	public AbstractCached,
+	virtual public ThreadSafe
+{
+public:
+
+	/**
+	 *
+	 */
+	ResonanceTableImplementation();
+
+	/**
+	 *
+	 */
+	virtual ~ResonanceTableImplementation();
+
+	/**
+	 * Get the Spectrum of the given Wave's type, calling wave->GetProperties() only if that type has not been seen before. <br />
+	 * @param wave
+	 * @return the Spectrum of wave; empty if wave is NULL.
+	 */
+	Spectrum GetSpectrumOf(const Wave* wave);
+
+	/**
+	 * Get the Spectrum of T::GetClassProperties(), calling it only once. <br />
+	 * @tparam T any class with a static GetClassProperties() method.
+	 * @return the Spectrum of T's class Properties.
+	 */
+	template < typename T >
+	Spectrum GetClassSpectrumOf()
+	{
+		const ::std::type_info& type = typeid(T);
+		const uint64_t key = GetKeyFor(
+			type,
+			sClassOffset
+		);
+		Spectrum ret;
+		uint64_t generation;
+		if (Find(
+			key,
+			type,
+			sClassOffset,
+			ret,
+			generation
+		))
+		{
+			return ret;
+		}
+		ret = Spectrum(T::GetClassProperties());
+		Record(
+			key,
+			type,
+			sClassOffset,
+			ret,
+			generation
+		);
+		return ret;
+	}
+
+	/**
+	 * Forget all Spectra and start a new generation. <br />
+	 * Override of AbstractCached. <br />
+	 */
+	virtual void Flush();
+
+	/**
+	 * @return the number of types *this currently remembers.
+	 */
+	Index GetNumberOfSpectra() const;
+
+protected:
+	/**
+	 * An entry in mTable; mType of NULL means unused. <br />
+	 * mKey is the hash of mType & mOffset, which decides where the Entry goes. <br />
+	 */
+	struct Entry
+	{
+		uint64_t mKey;
+		const ::std::type_info* mType;
+		uint64_t mOffset;
+		Spectrum mSpectrum;
+	};
+
+	/**
+	 * The offset used for GetClassSpectrumOf(), which no Wave can have within its most derived object. <br />
+	 */
+	static const uint64_t sClassOffset = ~uint64_t(0);
+
+	/**
+	 * @param wave must not be NULL.
+	 * @return how far into its most derived object wave is.
+	 */
+	static uint64_t GetOffsetOf(const Wave* wave);
+
+	/**
+	 * @param type
+	 * @param offset
+	 * @return the hash of type & offset.
+	 */
+	static uint64_t GetKeyFor(
+		const ::std::type_info& type,
+		const uint64_t offset
+	);
+
+	/**
+	 * @param entry must be used.
+	 * @param type
+	 * @param offset
+	 * @return whether or not entry is for type & offset.
+	 */
+	static bool IsEntryFor(
+		const Entry& entry,
+		const ::std::type_info& type,
+		const uint64_t offset
+	);
+
+	/**
+	 * @param key from GetKeyFor(type, offset).
+	 * @param type
+	 * @param offset
+	 * @param spectrum where to put the found Spectrum.
+	 * @param generation where to put the generation *this was searched in; give this to Record().
+	 * @return whether or not type & offset were found.
+	 */
+	bool Find(
+		const uint64_t key,
+		const ::std::type_info& type,
+		const uint64_t offset,
+		Spectrum& spectrum,
+		uint64_t& generation
+	) const;
+
+	/**
+	 * @param key from GetKeyFor(type, offset).
+	 * @param type
+	 * @param offset
+	 * @param spectrum
+	 * @param generation from the Find() which missed; if *this has been Flush()ed since, spectrum may be stale and is dropped.
+	 */
+	void Record(
+		const uint64_t key,
+		const ::std::type_info& type,
+		const uint64_t offset,
+		const Spectrum& spectrum,
+		const uint64_t generation
+	);
+
+	/**
+	 * Open addressed, with a power of 2 size. <br />
+	 */
+	::std::vector< Entry > mTable;
+	Index mNumberOfSpectra;
+
+	/**
+	 * Incremented by each Flush(). <br />
+	 */
+	uint64_t mGeneration;
+};
+
+BIO_SINGLETON(ResonanceTable,
+	ResonanceTableImplementation)
+
+} //physical namespace
+} //bio namespace
@@ -47,12 +47,14 @@ BIO_ID_WITH_PLURAL(className, className##s, dimension)
  * To make defining ids easier, use this macro to define the function body of your Id Function(). <br />
  * This will assign a value to a string that is identical to your FunctionName e.g. SafelyAccess<MyPerspective>()->GetNameFromId(Value()) would give "Value". <br />
  * Necessitates that functionName be a part of any namespaces are already specified (e.g. using namespace somewhere above a call to this macro). <br />
+ * The Name is kept alongside the CachedId, since CachedId only holds a reference to its lookup and must be able to look it up again when Flush()ed. <br />
  */
 #define BIO_ID_FUNCTION_BODY(functionName, perspective, dimension)             \
 dimension functionName()                                                       \
 {                                                                              \
+    static const ::bio::Name s##functionName##Name(#functionName);             \
     static ::bio::CachedId< dimension >                                        \
-        s##functionName(#functionName, perspective);                           \
+        s##functionName(s##functionName##Name, perspective);                   \
     return s##functionName;                                                    \
 }
 
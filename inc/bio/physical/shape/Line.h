@@ -23,6 +23,15 @@
 
 #include "Linear.h"
 #include "bio/common/container/Arrangement.h"
+#include <vector>
+
+//@formatter:off
+#if BIO_CPP_VERSION < 11
+	#include <stdint.h>
+#else
+	#include <cstdint>
+#endif
+//@formatter:on
 
 namespace bio {
 namespace physical {
@@ -32,6 +41,12 @@ namespace physical {
  *
  * NOTE: We reserve Position 0 as invalid. <br />
  *
+ * Lines keep hash indices of the Ids and Names of their contents, so that SeekToId() and SeekToName() are constant time. <br />
+ * These are maintained by Add, Insert, Erase, and Clear. <br />
+ * Seeking does not modify *this, so any number of threads may Seek at once, so long as none are modifying *this. <br />
+ * The indices cannot see an Identifiable change its Id or Name. So, contents should be given their final Id & Name before being added (e.g. Surface::SetEnvironment() is called before a Molecule Adds the Surface). <br />
+ * Whoever changes the Id or Name of a content while it is in *this (or reassigns a Linear in *this) is responsible for calling Reindex() before *this is Sought again; otherwise, the content may not be found. <br />
+ *
  * @tparam STORE
  */
 class Line :
@@ -62,14 +77,14 @@ public:
 	 * @param name
 	 * @return an Index matching the given name or InvalidIndex().
 	 */
-	virtual Index SeekToName(const Name& name);
+	virtual Index SeekToName(const Name& name) const;
 
 	/**
 	 * Get the position of an Identifiable< Id >* with the given id in *this.
 	 * @param id
 	 * @return an Index matching the given id or InvalidIndex().
 	 */
-	virtual Index SeekToId(const Id& id);
+	virtual Index SeekToId(const Id& id) const;
 
 	/**
 	 * Since we operate on Identifiable< Id >*, not Linears, we want to treat the external datum as Identifiable< Id >*. <br />
@@ -96,8 +111,107 @@ public:
 	 */
 	virtual const Identifiable< Id >* LinearAccess(Index index) const;
 
+	/**
+	 * Adds content to *this and indexes it. <br />
+	 * @param content
+	 * @return the Index of the added content.
+	 */
+	virtual Index Add(const ByteStream content);
+
+	/**
+	 * Inserts content at the given Index, moving all later contents up by 1. <br />
+	 * @param content
+	 * @param index
+	 * @return the Index of the inserted content.
+	 */
+	virtual Index Insert(
+		const ByteStream content,
+		const Index index
+	);
+
+	/**
+	 * Removes the content at the given Index from *this and from the indices of *this. <br />
+	 * @param index
+	 * @return the erased content.
+	 */
+	virtual ByteStream Erase(Index index);
+
+	/**
+	 * Removes all contents from *this. <br />
+	 */
+	virtual void Clear();
+
+	/**
+	 * Rebuild the Id and Name indices of *this from its contents. <br />
+	 * This is only necessary if the contents of *this were changed without going through *this. <br />
+	 */
+	void Reindex();
+
 protected:
-	Iterator* mTempItt;
+	/**
+	 * A slot in an IndexTable: the key of some content and where that content is. <br />
+	 * Empty slots have an mIndex of InvalidIndex(). <br />
+	 */
+	struct IndexEntry
+	{
+		uint64_t mKey;
+		Index mIndex;
+	};
+
+	/**
+	 * An open addressed, linearly probed hash table of IndexEntries. <br />
+	 * The size is always 0 or a power of 2. <br />
+	 */
+	typedef ::std::vector< IndexEntry > IndexTable;
+
+	/**
+	 * @param id
+	 * @return a well distributed key for id.
+	 */
+	static uint64_t GetIdKey(const Id& id);
+
+	/**
+	 * Add the key & index pair to table. <br />
+	 * table must have at least 1 empty slot. <br />
+	 * @param table
+	 * @param key
+	 * @param index
+	 */
+	static void InsertIntoTable(
+		IndexTable& table,
+		const uint64_t key,
+		const Index index
+	);
+
+	/**
+	 * Remove the key & index pair from table. <br />
+	 * If key is no longer that of the content at index, the entry for index is found by checking every slot. <br />
+	 * Nop if index is not in table. <br />
+	 * @param table
+	 * @param key
+	 * @param index
+	 */
+	static void RemoveFromTable(
+		IndexTable& table,
+		const uint64_t key,
+		const Index index
+	);
+
+	/**
+	 * Add the content at the given Index to mIdIndex & mNameIndex, growing them as necessary. <br />
+	 * @param index
+	 */
+	void IndexContent(const Index index);
+
+	/**
+	 * Remove the content at the given Index from mIdIndex & mNameIndex. <br />
+	 * @param index
+	 */
+	void UnindexContent(const Index index);
+
+	IndexTable mIdIndex;
+	IndexTable mNameIndex;
+	Index mNumIndexed;
 };
 
 } //physical namespace
@@ -31,6 +31,7 @@ Atom::Atom()
 	physical::Class< Atom >(this),
 	mBonds(4)
 {
+	ClearBondSlots();
 }
 
 Atom::Atom(const Atom& other)
@@ -38,7 +39,48 @@ Atom::Atom(const Atom& other)
 	physical::Class< Atom >(this),
 	mBonds(other.mBonds.GetCapacity())
 {
+	ClearBondSlots();
+}
 
+Atom& Atom::operator=(const Atom& other)
+{
+	if (this == &other)
+	{
+		return *this;
+	}
+	physical::Class< Atom >::operator=(other);
+	mBonds = other.mBonds;
+
+	ClearBondSlots();
+	AtomicNumber id;
+	Valence position;
+	Bond* bond;
+	for (
+		::std::size_t slt = 0;
+		slt < sBondSlots;
+		++slt
+		)
+	{
+		//@formatter:off
+		#if BIO_CPP_VERSION >= 11
+			id = other.mBondSlots[slt].mId.load(::std::memory_order_relaxed);
+		#else
+			id = other.mBondSlots[slt].mId;
+		#endif
+		//@formatter:on
+		if (other.ReadBondSlot(
+			id,
+			position,
+			bond
+		))
+		{
+			CacheBondPosition(
+				id,
+				position
+			);
+		}
+	}
+	return *this;
 }
 
 Atom::~Atom()
@@ -58,6 +100,7 @@ Atom::~Atom()
 		}
 	}
 	mBonds.Clear();
+	ClearBondSlots();
 }
 
 Code Atom::Attenuate(const physical::Wave* other)
@@ -80,10 +123,10 @@ Code Atom::Attenuate(const physical::Wave* other)
 		{
 			continue;
 		}
-		if (physical::Wave::GetResonanceBetween(
+		if (physical::Wave::Resonates(
 			bond->GetBonded(),
 			other
-		).Size())
+		))
 		{
 			if (bond->GetBonded()->Attenuate(demodulated) != code::Success())
 			{
@@ -114,10 +157,10 @@ Code Atom::Disattenuate(const physical::Wave* other)
 		{
 			continue;
 		}
-		if (physical::Wave::GetResonanceBetween(
+		if (physical::Wave::Resonates(
 			bond->GetBonded(),
 			other
-		).Size())
+		))
 		{
 			if (bond->GetBonded()->Disattenuate(demodulated) != code::Success())
 			{
@@ -150,17 +193,26 @@ Valence Atom::FormBondImplementation(
 			type
 		))
 		{
+			CacheBondPosition(
+				id,
+				position
+			);
 			return position;
 		}
 		return InvalidIndex();
 	}
 
-	return mBonds.Add(
+	position = mBonds.Add(
 		new Bond(
 			id,
 			toBond,
 			type
 		));
+	CacheBondPosition(
+		id,
+		position
+	);
+	return position;
 }
 
 bool Atom::BreakBondImplementation(
@@ -177,6 +229,7 @@ bool Atom::BreakBondImplementation(
 
 	mBonds.OptimizedAccess(position)->Break();
 	//Let dtor cleanup.
+	//The Broken Bond keeps its id and position, so the Bond position cache is still correct.
 
 	return true;
 }
@@ -187,15 +240,24 @@ Valence Atom::GetBondPosition(AtomicNumber bondedId) const
 	BIO_SANITIZE(bondedId, ,
 		return InvalidIndex());
 
+	Valence position;
 	Bond* bond;
+	if (ReadBondSlot(
+		bondedId,
+		position,
+		bond
+	))
+	{
+		return position;
+	}
+
 	for (
-		SmartIterator bnd = mBonds.End();
-		!bnd.IsBeforeBeginning();
-		--bnd
+		Bonds::const_iterator bnd = mBonds.begin();
+		bnd != mBonds.end();
+		++bnd
 		)
 	{
-		bond = bnd;
-		if (bond->GetId() == bondedId)
+		if ((*bnd)->GetId() == bondedId)
 		{
 			return bnd.GetIndex();
 		}
@@ -205,7 +267,7 @@ Valence Atom::GetBondPosition(AtomicNumber bondedId) const
 
 Valence Atom::GetBondPosition(const Name& typeName) const
 {
-	return GetBondPosition(SafelyAccess<PeriodicTable>()->GetIdWithoutCreation(typeName));
+	return GetBondPosition(PeriodicTable::Instance().ReadIdWithoutCreation(typeName));
 }
 
 BondType Atom::GetBondType(Valence position) const
@@ -241,6 +303,132 @@ const physical::Wave* Atom::GetBonded(Valence position) const
 	return mBonds.OptimizedAccess(position)->GetBonded();
 }
 
+void Atom::ClearBondSlots()
+{
+	for (
+		::std::size_t slt = 0;
+		slt < sBondSlots;
+		++slt
+		)
+	{
+		//@formatter:off
+		#if BIO_CPP_VERSION >= 11
+			mBondSlots[slt].mSequence.store(0, ::std::memory_order_relaxed);
+			mBondSlots[slt].mId.store(0, ::std::memory_order_relaxed);
+			mBondSlots[slt].mPosition.store(0, ::std::memory_order_relaxed);
+			mBondSlots[slt].mBond.store(NULL, ::std::memory_order_relaxed);
+		#else
+			mBondSlots[slt].mSequence = 0;
+			mBondSlots[slt].mId = 0;
+			mBondSlots[slt].mPosition = 0;
+			mBondSlots[slt].mBond = NULL;
+		#endif
+		//@formatter:on
+	}
+}
+
+void Atom::CacheBondPosition(
+	AtomicNumber bondedId,
+	Valence position
+)
+{
+	if (!bondedId || !position)
+	{
+		return;
+	}
+	BondSlot& slot = mBondSlots[bondedId & (sBondSlots - 1)];
+	Bond* bond = mBonds.OptimizedAccess(position);
+
+	//Make the sequence odd while we write, then even again once the whole entry is written.
+	//@formatter:off
+	#if BIO_CPP_VERSION >= 11
+		uint32_t sequence = slot.mSequence.load(::std::memory_order_relaxed);
+		slot.mSequence.store(sequence + 1, ::std::memory_order_relaxed);
+		::std::atomic_thread_fence(::std::memory_order_release);
+		slot.mId.store(bondedId, ::std::memory_order_relaxed);
+		slot.mPosition.store(position, ::std::memory_order_relaxed);
+		slot.mBond.store(bond, ::std::memory_order_relaxed);
+		slot.mSequence.store(sequence + 2, ::std::memory_order_release);
+	#else
+		uint32_t sequence = slot.mSequence;
+		slot.mSequence = sequence + 1;
+		#if defined(__GNUC__)
+			__sync_synchronize();
+		#endif
+		slot.mId = bondedId;
+		slot.mPosition = position;
+		slot.mBond = bond;
+		#if defined(__GNUC__)
+			__sync_synchronize();
+		#endif
+		slot.mSequence = sequence + 2;
+	#endif
+	//@formatter:on
+}
+
+bool Atom::ReadBondSlot(
+	AtomicNumber bondedId,
+	Valence& position,
+	Bond*& bond
+) const
+{
+	if (!bondedId)
+	{
+		return false;
+	}
+	const BondSlot& slot = mBondSlots[bondedId & (sBondSlots - 1)];
+
+	//@formatter:off
+	#if BIO_CPP_VERSION >= 11
+		uint32_t sequence = slot.mSequence.load(::std::memory_order_acquire);
+		if (sequence & 1 || slot.mId.load(::std::memory_order_relaxed) != bondedId)
+		{
+			return false;
+		}
+		position = slot.mPosition.load(::std::memory_order_relaxed);
+		bond = slot.mBond.load(::std::memory_order_relaxed);
+		::std::atomic_thread_fence(::std::memory_order_acquire);
+		return slot.mSequence.load(::std::memory_order_relaxed) == sequence;
+	#else
+		uint32_t sequence = slot.mSequence;
+		#if defined(__GNUC__)
+			__sync_synchronize();
+		#endif
+		if (sequence & 1 || slot.mId != bondedId)
+		{
+			return false;
+		}
+		position = slot.mPosition;
+		bond = slot.mBond;
+		#if defined(__GNUC__)
+			__sync_synchronize();
+		#endif
+		return slot.mSequence == sequence;
+	#endif
+	//@formatter:on
+}
+
+Bond* Atom::GetBond(AtomicNumber bondedId) const
+{
+	Valence position;
+	Bond* bond;
+	if (ReadBondSlot(
+		bondedId,
+		position,
+		bond
+	))
+	{
+		return bond;
+	}
+
+	position = GetBondPosition(bondedId);
+	if (!position)
+	{
+		return NULL;
+	}
+	return mBonds.OptimizedAccess(position);
+}
+
 Bonds* Atom::GetAllBonds()
 {
 	return &mBonds;
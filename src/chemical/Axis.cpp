@@ -22,6 +22,7 @@
 #include "bio/chemical/Axis.h"
 #include "bio/chemical/Symmetry.h"
 #include "bio/chemical/structure/motif/UnorderedMotif.h"
+#include "bio/physical/shape/Line.h"
 
 namespace bio {
 namespace chemical {
@@ -40,14 +41,15 @@ std::string Axis::Rotate(Symmetry* symmetry) const
 {
 	std::string ret = "";
 	ret += Encode(symmetry);
-	Container* toRotate = symmetry->GetAll< Symmetry* >();
+	//Symmetries are contained in a LinearMotif, so what we get back is a Line.
+	physical::Line* toRotate = Cast< physical::Line* >(symmetry->GetAll< Symmetry* >());
 	for (
 		SmartIterator sym = toRotate->Begin();
 		!sym.IsAfterEnd();
 		++sym
 		)
 	{
-		ret += Rotate(sym.As< Symmetry* >());
+		ret += Rotate(ChemicalCast< Symmetry* >(toRotate->LinearAccess(sym.GetIndex())));
 	}
 
 	return ret;
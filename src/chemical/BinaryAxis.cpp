@@ -0,0 +1,415 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2022 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "bio/chemical/BinaryAxis.h"
+#include "bio/chemical/Symmetry.h"
+#include "bio/chemical/structure/motif/UnorderedMotif.h"
+#include "bio/physical/shape/Line.h"
+#include "bio/physical/common/Codes.h"
+
+namespace bio {
+namespace chemical {
+
+BinaryAxis::BinaryAxis()
+{
+
+}
+
+BinaryAxis::~BinaryAxis()
+{
+
+}
+
+std::string BinaryAxis::Rotate(Symmetry* symmetry) const
+{
+	Buffer out;
+	if (Rotate(
+		symmetry,
+		out
+	) != code::Success())
+	{
+		return Failed();
+	}
+	return ::std::string(
+		out.begin(),
+		out.end());
+}
+
+physical::Symmetry* BinaryAxis::Rotate(std::string encoded) const
+{
+	return Rotate(
+		reinterpret_cast< const unsigned char* >(encoded.data()),
+		encoded.size());
+}
+
+Code BinaryAxis::Rotate(
+	const Symmetry* symmetry,
+	Buffer& out
+) const
+{
+	BIO_SANITIZE(symmetry, ,
+		return code::Invalid())
+
+	::std::size_t lengthPosition = out.size();
+	out.resize(lengthPosition + sizeof(uint32_t));
+	if (!EncodeTree(
+		symmetry,
+		out
+	) || !WriteLength(
+		out,
+		lengthPosition
+	))
+	{
+		out.resize(lengthPosition);
+		return code::BadArgument1();
+	}
+	return code::Success();
+}
+
+Symmetry* BinaryAxis::Rotate(const Buffer& in) const
+{
+	if (in.empty())
+	{
+		return NULL;
+	}
+	return Rotate(
+		&in[0],
+		in.size());
+}
+
+Symmetry* BinaryAxis::Rotate(
+	const unsigned char* in,
+	::std::size_t size,
+	::std::size_t* read
+) const
+{
+	BIO_SANITIZE(in, ,
+		return NULL)
+	if (size < sizeof(uint32_t))
+	{
+		return NULL;
+	}
+
+	::std::size_t length = 0;
+	for (
+		::std::size_t byte = 0;
+		byte < sizeof(uint32_t);
+		++byte
+		)
+	{
+		length |= ::std::size_t(in[byte]) << (8 * byte);
+	}
+	if (length > size - sizeof(uint32_t))
+	{
+		return NULL;
+	}
+
+	const unsigned char* cursor = in + sizeof(uint32_t);
+	const unsigned char* end = cursor + length;
+	Symmetry* ret = DecodeTree(
+		cursor,
+		end
+	);
+	if (ret && cursor != end)
+	{
+		//Trailing bytes inside the tree mean the length and the tree disagree.
+		delete ret;
+		ret = NULL;
+	}
+	if (ret && read)
+	{
+		*read = sizeof(uint32_t) + length;
+	}
+	return ret;
+}
+
+std::string BinaryAxis::Encode(physical::Symmetry* symmetry) const
+{
+	BIO_SANITIZE(symmetry, ,
+		return Failed())
+
+	Buffer out(sizeof(uint32_t));
+	EncodeSymmetry(
+		symmetry,
+		out
+	);
+	WriteVarInt(
+		0,
+		out
+	);
+	if (!WriteLength(
+		out,
+		0
+	))
+	{
+		return Failed();
+	}
+	return ::std::string(
+		out.begin(),
+		out.end());
+}
+
+void BinaryAxis::EncodeSymmetry(
+	const physical::Symmetry* symmetry,
+	Buffer& out
+) const
+{
+	WriteVarInt(
+		symmetry->GetId(),
+		out
+	);
+	WriteVarInt(
+		symmetry->GetType().GetId(),
+		out
+	);
+
+	const ByteStream& value = symmetry->GetValue();
+	::std::size_t size = value.IsEmpty() ? 0 : value.GetSize();
+	WriteVarInt(
+		size,
+		out
+	);
+	if (!size)
+	{
+		return;
+	}
+
+	type::TypeHash typeId = value.GetTypeId();
+	::std::size_t position = out.size();
+	out.resize(position + sizeof(type::TypeHash) + size);
+	for (
+		::std::size_t byte = 0;
+		byte < sizeof(type::TypeHash);
+		++byte
+		)
+	{
+		out[position++] = (unsigned char)(typeId >> (8 * byte));
+	}
+	::std::memcpy(
+		&out[position],
+		value.DirectAccess(),
+		size
+	);
+}
+
+bool BinaryAxis::EncodeTree(
+	const Symmetry* symmetry,
+	Buffer& out,
+	unsigned int depth
+) const
+{
+	if (depth > sMaxDepth)
+	{
+		return false;
+	}
+
+	EncodeSymmetry(
+		symmetry,
+		out
+	);
+
+	//Symmetries are contained in a LinearMotif, so what we get back is a Line.
+	const physical::Line* contents = Cast< const physical::Line* >(symmetry->GetAll< Symmetry* >());
+	Index count = contents ? contents->GetNumberOfElements() : 0;
+	WriteVarInt(
+		count,
+		out
+	);
+	if (!count)
+	{
+		return true;
+	}
+
+	for (
+		Index cnt = contents->GetBeginIndex();
+		cnt != InvalidIndex();
+		cnt = contents->GetNextAllocatedIndex(cnt + 1)
+		)
+	{
+		if (!EncodeTree(
+			ChemicalCast< const Symmetry* >(contents->LinearAccess(cnt)),
+			out,
+			depth + 1
+		))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+Symmetry* BinaryAxis::DecodeTree(
+	const unsigned char*& cursor,
+	const unsigned char* end,
+	unsigned int depth
+) const
+{
+	if (depth > sMaxDepth)
+	{
+		return NULL;
+	}
+
+	uint64_t id;
+	uint64_t type;
+	uint64_t size;
+	if (!ReadVarInt(
+		cursor,
+		end,
+		id
+	) || !ReadVarInt(
+		cursor,
+		end,
+		type
+	) || !ReadVarInt(
+		cursor,
+		end,
+		size
+	))
+	{
+		return NULL;
+	}
+	Id symmetryId = Id(id);
+	SymmetryType symmetryType = SymmetryType(type);
+	if (uint64_t(symmetryId) != id || uint64_t(symmetryType) != type)
+	{
+		//Too large to be an Id.
+		return NULL;
+	}
+	if (size && (::std::size_t(end - cursor) < sizeof(type::TypeHash) || size > ::std::size_t(end - cursor) - sizeof(type::TypeHash)))
+	{
+		return NULL;
+	}
+
+	Symmetry* ret = new Symmetry(
+		symmetryId,
+		symmetryType
+	);
+
+	if (size)
+	{
+		type::TypeHash typeId = 0;
+		for (
+			::std::size_t byte = 0;
+			byte < sizeof(type::TypeHash);
+			++byte
+			)
+		{
+			typeId |= type::TypeHash(*cursor++) << (8 * byte);
+		}
+		ret->AccessValue()->Set(
+			cursor,
+			::std::size_t(size),
+			typeId
+		);
+		cursor += size;
+	}
+
+	uint64_t count;
+	if (!ReadVarInt(
+		cursor,
+		end,
+		count
+	))
+	{
+		delete ret;
+		return NULL;
+	}
+	for (
+		uint64_t child = 0;
+		child < count;
+		++child
+		)
+	{
+		Symmetry* content = DecodeTree(
+			cursor,
+			end,
+			depth + 1
+		);
+		if (!content)
+		{
+			delete ret;
+			return NULL;
+		}
+		ret->Add< Symmetry* >(content);
+	}
+	return ret;
+}
+
+/*static*/ void BinaryAxis::WriteVarInt(
+	uint64_t value,
+	Buffer& out
+)
+{
+	while (value >= 0x80)
+	{
+		out.push_back((unsigned char)(value | 0x80));
+		value >>= 7;
+	}
+	out.push_back((unsigned char)value);
+}
+
+/*static*/ bool BinaryAxis::ReadVarInt(
+	const unsigned char*& cursor,
+	const unsigned char* end,
+	uint64_t& value
+)
+{
+	value = 0;
+	for (
+		unsigned int shift = 0;
+		cursor < end && shift < 64;
+		shift += 7
+		)
+	{
+		unsigned char byte = *cursor++;
+		value |= uint64_t(byte & 0x7F) << shift;
+		if (!(byte & 0x80))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+/*static*/ bool BinaryAxis::WriteLength(
+	Buffer& out,
+	::std::size_t lengthPosition
+)
+{
+	uint64_t fullLength = uint64_t(out.size() - lengthPosition - sizeof(uint32_t));
+	if (fullLength > uint64_t(uint32_t(-1)))
+	{
+		return false;
+	}
+	uint32_t length = uint32_t(fullLength);
+	for (
+		::std::size_t byte = 0;
+		byte < sizeof(uint32_t);
+		++byte
+		)
+	{
+		out[lengthPosition + byte] = (unsigned char)(length >> (8 * byte));
+	}
+	return true;
+}
+
+} //chemical namespace
+} //bio namespace
@@ -92,6 +92,22 @@ const Properties PeriodicTableImplementation::GetPropertiesOf(const Name& name)
 	return GetPropertiesOf(GetIdWithoutCreation(name));
 }
 
+const Properties PeriodicTableImplementation::ReadPropertiesOf(AtomicNumber id) const
+{
+	if (id == InvalidId())
+	{
+		return Properties();
+	}
+
+	//An Element's Properties never change once Recorded, so they may be read without locking.
+	const Element* element = ForceCast< const Element* >(ReadRecordFromId(id));
+	if (!element)
+	{
+		return Properties();
+	}
+	return *Cast< const Properties* >(element);
+}
+
 AtomicNumber PeriodicTableImplementation::RecordPropertyOf(
 	AtomicNumber id,
 	Property property
@@ -121,16 +137,17 @@ AtomicNumber PeriodicTableImplementation::RecordPropertiesOf(
 	Properties properties
 )
 {
-	SmartIterator brn = Find(id);
-	BIO_SANITIZE_AT_SAFETY_LEVEL_1(brn.IsValid(), ,
+	Brane* brane = GetBraneFromId(id);
+	BIO_SANITIZE_AT_SAFETY_LEVEL_1(brane, ,
 		return InvalidId());
 
-	Brane* brane = brn;
 	Element* element = ForceCast< Element* >(brane->mType);
 	if (!element)
 	{
 		element = new Element(&properties);
 		brane->mType = element->AsWave();
+		Republish();
+		physical::ResonanceTable::Instance().Flush(); //Waves of this type may have been remembered with different Properties.
 	}
 	return id;
 }
@@ -167,6 +184,7 @@ bool PeriodicTableImplementation::AssociateType(
 		return false
 	)
 	element->mType = type;
+	Republish();
 	return true;
 }
 
@@ -178,8 +196,62 @@ bool PeriodicTableImplementation::DisassociateType(AtomicNumber id)
 		return false
 	)
 	element->mType = NULL;
+	Republish();
 	return true;
 }
 
+void PeriodicTableImplementation::WriteTypeImage(
+	const Brane* brane,
+	::std::vector< unsigned char >& typeImage
+) const
+{
+	const Element* element = ForceCast< const Element* >(brane->mType);
+	if (!element)
+	{
+		return;
+	}
+	const Properties* properties = Cast< const Properties* >(element);
+	uint64_t property;
+	for (
+		Index prp = properties->GetBeginIndex();
+		prp != InvalidIndex();
+		prp = properties->GetNextAllocatedIndex(prp + 1))
+	{
+		property = ::std::size_t(Property(properties->OptimizedAccess(prp)));
+		typeImage.insert(
+			typeImage.end(),
+			reinterpret_cast< const unsigned char* >(&property),
+			reinterpret_cast< const unsigned char* >(&property + 1));
+	}
+}
+
+void PeriodicTableImplementation::ReadTypeImage(
+	Brane* brane,
+	const unsigned char* typeImage,
+	::std::size_t size
+)
+{
+	if (brane->mType)
+	{
+		return;
+	}
+	const uint64_t* recorded = reinterpret_cast< const uint64_t* >(typeImage);
+	Properties properties;
+	for (
+		::std::size_t prp = 0;
+		prp < size / sizeof(uint64_t);
+		++prp
+		)
+	{
+		properties.Add(Property(::std::size_t(recorded[prp])));
+	}
+	Element* element = new Element(&properties);
+	brane->mType = element->AsWave();
+
+	//As in RecordPropertiesOf(), Waves of this type may have been remembered with different Properties.
+	//This must Flush() even when the ResonanceTable is empty, so that Spectra being built right now are not Recorded.
+	physical::ResonanceTable::Instance().Flush();
+}
+
 } //chemical namespace
 } //bio namespace
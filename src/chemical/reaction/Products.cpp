@@ -49,10 +49,9 @@ Products::Products(const Substances* substances)
 
 Products::Products(const Reactants* reactants)
 	:
-	mResult(code::Success()),
-	mSubstances(reactants->GetAll< Substance* >())
+	mResult(code::Success())
 {
-
+	reactants->Export(mSubstances);
 }
 
 Products::Products(
@@ -66,11 +65,48 @@ Products::Products(
 
 }
 
+Products::Products(
+	Code result,
+	const Reactants* reactants
+)
+	:
+	mResult(result)
+{
+	BIO_SANITIZE(reactants, , return)
+	reactants->Export(mSubstances);
+}
+
+Products::Products(const Products& other)
+{
+	*this = other;
+}
+
 Products::~Products()
 {
 
 }
 
+Products& Products::operator=(const Products& other)
+{
+	if (this == &other)
+	{
+		return *this;
+	}
+	mResult = other.mResult;
+
+	//Substances (i.e. Containers) cannot be assigned, so we copy the pointers ourselves.
+	mSubstances.Clear();
+	for (
+		SmartIterator sub = other.mSubstances.Begin();
+		!sub.IsAfterEnd();
+		++sub
+		)
+	{
+		mSubstances.Add(sub.As< Substance* >());
+	}
+	return *this;
+}
+
 Products::operator Code()
 {
 	return mResult;
@@ -86,6 +122,11 @@ Products::operator Reactants()
 	return Reactants(mSubstances);
 }
 
+const Substances& Products::GetSubstances() const
+{
+	return mSubstances;
+}
+
 bool Products::operator!=(const Code code) const
 {
 	return mResult != code;
@@ -52,7 +52,100 @@ Reactants::~Reactants()
 
 Reactants::operator Substances()
 {
-	return GetAll< Substance* >();
+	//GetAll() gives our Linear wrappers, not Substance*s, so we can't copy it directly.
+	Substances ret;
+	Export(ret);
+	return ret;
+}
+
+void Reactants::Export(Substances& substances) const
+{
+	for (
+		SmartIterator sub = this->mContents->Begin();
+		!sub.IsAfterEnd();
+		++sub
+		)
+	{
+		substances.Add(ChemicalCast< Substance* >(sub.As< physical::Linear >().operator physical::Identifiable< Id >*()));
+	}
+}
+
+void Reactants::Reset(const Substances& substances)
+{
+	ClearImplementation();
+	for (
+		SmartIterator sub = substances.Begin();
+		!sub.IsAfterEnd();
+		++sub
+		)
+	{
+		//Linear wrappers are Shared by default, so *this will not delete what it is given.
+		this->mContents->Add(physical::Linear(sub.As< Substance* >()));
+	}
+}
+
+ReactantsPool::ReactantsPool()
+{
+
+}
+
+ReactantsPool::ReactantsPool(const ReactantsPool& toCopy)
+	:
+	ThreadSafe(toCopy)
+{
+
+}
+
+ReactantsPool::~ReactantsPool()
+{
+	for (
+		::std::vector< Reactants* >::iterator idle = mIdle.begin();
+		idle != mIdle.end();
+		++idle
+		)
+	{
+		delete *idle;
+	}
+}
+
+ReactantsPool& ReactantsPool::operator=(const ReactantsPool& /*toCopy*/)
+{
+	//The idle Reactants belong to whichever pool made them; they are deliberately not shared, so there is nothing to copy.
+	return *this;
+}
+
+Reactants* ReactantsPool::Borrow()
+{
+	Reactants* ret = NULL;
+	LockThread();
+	if (!mIdle.empty())
+	{
+		ret = mIdle.back();
+		mIdle.pop_back();
+	}
+	UnlockThread();
+	if (!ret)
+	{
+		ret = new Reactants();
+	}
+	return ret;
+}
+
+void ReactantsPool::Return(Reactants* reactants)
+{
+	BIO_SANITIZE(reactants, , return)
+	reactants->Clear< Substance* >();
+	LockThread();
+	mIdle.push_back(reactants);
+	UnlockThread();
+}
+
+Index ReactantsPool::GetNumberOfIdleReactants() const
+{
+	LockThread();
+	Index ret = mIdle.size();
+	UnlockThread();
+	return ret;
 }
 
 } //chemical namespace
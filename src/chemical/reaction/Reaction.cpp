@@ -23,6 +23,7 @@
 #include "bio/chemical/reaction/Reactant.h"
 #include "bio/chemical/common/Codes.h"
 #include "bio/chemical/common/Filters.h"
+#include "bio/common/container/Bitmap.h"
 
 namespace bio {
 namespace chemical {
@@ -81,7 +82,7 @@ bool Reaction::ReactantsMeetRequirements(const Reactants* toCheck) const
 
 /*static*/ const Reaction* Reaction::Initiate(const Id& id)
 {
-	BIO_SANITIZE_WITH_CACHE(SafelyAccess<ReactionPerspective>()->GetTypeFromIdAs< Reaction* >(id),
+	BIO_SANITIZE_WITH_CACHE(SafelyRead<ReactionPerspective>()->GetTypeFromIdAs< Reaction* >(id),
 		return Cast< Reaction* >(RESULT),
 		return NULL);
 }
@@ -94,5 +95,48 @@ Products Reaction::operator()(Reactants* reactants) const
 		return code::FailedReaction());
 }
 
+void Reaction::ProcessEach(
+	Reactants* const* reactants,
+	const Index count,
+	Products* products
+) const
+{
+	BIO_SANITIZE(reactants && products, , return)
+
+	Bitmap meetsRequirements(count);
+	for (
+		Index index = 0;
+		index < count;
+		++index
+		)
+	{
+		if (reactants[index] && ReactantsMeetRequirements(reactants[index]))
+		{
+			meetsRequirements.Set(index);
+		}
+		else
+		{
+			products[index] = Products(code::FailedReaction());
+		}
+	}
+
+	Bitmap::Word word;
+	Index index;
+	for (
+		::std::size_t position = 0;
+		position < meetsRequirements.GetWordCount();
+		++position
+		)
+	{
+		word = meetsRequirements.GetWord(position);
+		while (word)
+		{
+			index = position * Bitmap::sWordBits + Bitmap::LowestSetBit(word);
+			products[index] = Process(reactants[index]);
+			word &= word - 1;
+		}
+	}
+}
+
 } //chemical namespace
 } //bio namespace
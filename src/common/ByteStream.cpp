@@ -21,25 +21,51 @@
 
 #include "bio/common/ByteStream.h"
 
+//@formatter:off
+#if BIO_CPP_VERSION >= 11
+	#include <utility>
+#endif
+//@formatter:on
+
 namespace bio {
 
 ByteStream::ByteStream()
 	:
 	mStream(NULL),
-	mTypeName(String::READ_ONLY),
+	mTypeTag(NULL),
+	mTypeId(0),
 	mSize(0),
-	mHolding(false)
+	mHolding(false),
+	mIsInline(false)
 {
 }
 
 ByteStream::ByteStream(const ByteStream& other)
 	:
-	mTypeName(String::READ_ONLY),
-	mHolding(false)
+	mStream(NULL),
+	mTypeTag(NULL),
+	mTypeId(0),
+	mSize(0),
+	mHolding(false),
+	mIsInline(false)
 {
 	*this = other;
 }
 
+#if BIO_CPP_VERSION >= 11
+ByteStream::ByteStream(ByteStream&& other)
+	:
+	mStream(NULL),
+	mTypeTag(NULL),
+	mTypeId(0),
+	mSize(0),
+	mHolding(false),
+	mIsInline(false)
+{
+	*this = ::std::move(other);
+}
+#endif
+
 ByteStream::~ByteStream()
 {
 	Release();
@@ -47,6 +73,11 @@ ByteStream::~ByteStream()
 
 void ByteStream::operator=(const ByteStream& other)
 {
+	if (this == &other)
+	{
+		return;
+	}
+
 	Release(); //wipe old state.
 
 	if (other.mHolding)
@@ -56,21 +87,62 @@ void ByteStream::operator=(const ByteStream& other)
 	}
 	else
 	{
-		mStream = other.mStream;
-		mTypeName = other.mTypeName;
+		std::memcpy(
+			mBuffer,
+			other.mBuffer,
+			sInlineCapacity
+		);
+		mTypeTag = other.mTypeTag;
+		mTypeId = other.mTypeId;
 		mSize = other.mSize;
+		mIsInline = other.mIsInline;
 		mHolding = false;
 	}
 }
 
+#if BIO_CPP_VERSION >= 11
+void ByteStream::operator=(ByteStream&& other)
+{
+	if (this == &other)
+	{
+		return;
+	}
+
+	Release(); //wipe old state.
+
+	//Whether inline or not, the bytes of other are all we need.
+	std::memcpy(
+		mBuffer,
+		other.mBuffer,
+		sInlineCapacity
+	);
+	mTypeTag = other.mTypeTag;
+	mTypeId = other.mTypeId;
+	mSize = other.mSize;
+	mIsInline = other.mIsInline;
+	mHolding = other.mHolding;
+
+	other.mStream = NULL;
+	other.mTypeTag = NULL;
+	other.mTypeId = 0;
+	other.mSize = 0;
+	other.mIsInline = false;
+	other.mHolding = false;
+}
+#endif
+
 bool ByteStream::IsEmpty() const
 {
-	return !mStream;
+	return !GetData();
 }
 
 String ByteStream::GetTypeName() const
 {
-	return mTypeName;
+	if (!mTypeTag)
+	{
+		return String(String::READ_ONLY);
+	}
+	return mTypeTag();
 }
 
 std::size_t ByteStream::GetSize() const
@@ -78,23 +150,61 @@ std::size_t ByteStream::GetSize() const
 	return mSize;
 }
 
+type::TypeHash ByteStream::GetTypeId() const
+{
+	return mTypeId;
+}
+
 void* ByteStream::DirectAccess()
 {
-	return mStream;
+	return GetData();
+}
+
+const void* ByteStream::DirectAccess() const
+{
+	return GetData();
 }
 
 void ByteStream::Set(const ByteStream& other)
 {
 	Release();
-	mStream = ::std::malloc(other.mSize);
 	memcpy(
-		mStream,
-		other.mStream,
+		Allocate(other.mSize),
+		other.GetData(),
 		other.mSize
 	);
-	mSize = other.mSize;
-	mTypeName = other.mTypeName;
+	mTypeTag = other.mTypeTag;
+	mTypeId = other.mTypeId;
+}
+
+void ByteStream::Set(
+	const void* data,
+	const ::std::size_t size,
+	const type::TypeHash typeId
+)
+{
+	Release();
+	memcpy(
+		Allocate(size),
+		data,
+		size
+	);
+	mTypeTag = NULL;
+	mTypeId = typeId;
+}
+
+void* ByteStream::Allocate(const ::std::size_t size)
+{
+	mSize = size;
 	mHolding = true;
+	if (size <= sInlineCapacity)
+	{
+		mIsInline = true;
+		return mBuffer;
+	}
+	mIsInline = false;
+	mStream = ::std::malloc(size);
+	return mStream;
 }
 
 void ByteStream::Release()
@@ -103,21 +213,27 @@ void ByteStream::Release()
 	{
 		return;
 	}
-	std::free(mStream);
+	if (!mIsInline)
+	{
+		std::free(mStream);
+	}
+	mStream = NULL;
 	mSize = 0;
-	mTypeName = "";
+	mTypeTag = NULL;
+	mTypeId = 0;
 	mHolding = false;
+	mIsInline = false;
 }
 
 bool ByteStream::operator==(const ByteStream& other) const
 {
-	if (mSize != other.mSize || mTypeName != other.mTypeName)
+	if (mSize != other.mSize || mTypeId != other.mTypeId)
 	{
 		return false;
 	}
 	return memcmp(
-		mStream,
-		other.mStream,
+		GetData(),
+		other.GetData(),
 		mSize
 	) == 0;
 }
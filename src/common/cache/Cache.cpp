@@ -37,12 +37,12 @@ Cache::~Cache()
 void Cache::Flush()
 {
 	for (
-		SmartIterator chd = End();
-		!chd.IsBeforeBeginning();
-		--chd
+		iterator chd = begin();
+		chd != end();
+		++chd
 		)
 	{
-		chd.As< AbstractCached* >()->Flush();
+		(*chd)->Flush();
 	}
 }
 
@@ -0,0 +1,180 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2022 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "bio/common/container/Bitmap.h"
+
+namespace bio {
+
+Bitmap::Bitmap(const Index size)
+	:
+	mSize(0)
+{
+	Resize(size);
+}
+
+Bitmap::~Bitmap()
+{
+
+}
+
+Index Bitmap::GetSize() const
+{
+	return mSize;
+}
+
+void Bitmap::Resize(const Index size)
+{
+	mWords.resize((size + sWordBits - 1) / sWordBits, 0);
+	mSize = size;
+
+	//Make sure bits past mSize stay unset, in case we shrunk.
+	if (mSize % sWordBits)
+	{
+		mWords.back() &= (Word(1) << (mSize % sWordBits)) - 1;
+	}
+}
+
+void Bitmap::Clear()
+{
+	for (
+		::std::size_t wrd = 0;
+		wrd < mWords.size();
+		++wrd
+		)
+	{
+		mWords[wrd] = 0;
+	}
+}
+
+void Bitmap::Union(const Bitmap& other)
+{
+	if (other.mSize > mSize)
+	{
+		Resize(other.mSize);
+	}
+	for (
+		::std::size_t wrd = 0;
+		wrd < other.mWords.size();
+		++wrd
+		)
+	{
+		mWords[wrd] |= other.mWords[wrd];
+	}
+}
+
+Index Bitmap::GetNextSet(const Index from) const
+{
+	if (from >= mSize)
+	{
+		return InvalidIndex();
+	}
+
+	::std::size_t wrd = from / sWordBits;
+	Word word = mWords[wrd] & (~Word(0) << (from % sWordBits));
+	while (!word)
+	{
+		if (++wrd == mWords.size())
+		{
+			return InvalidIndex();
+		}
+		word = mWords[wrd];
+	}
+	Index ret = Index(wrd * sWordBits + LowestSetBit(word));
+	BIO_SANITIZE_AT_SAFETY_LEVEL_1(ret < mSize, , return InvalidIndex())
+	return ret;
+}
+
+Index Bitmap::GetPreviousSet(const Index from) const
+{
+	if (!mSize)
+	{
+		return InvalidIndex();
+	}
+
+	Index start = from < mSize ? from : mSize - 1;
+	::std::size_t wrd = start / sWordBits;
+	unsigned int offset = start % sWordBits;
+	Word word = mWords[wrd];
+	if (offset != sWordBits - 1)
+	{
+		word &= (Word(1) << (offset + 1)) - 1;
+	}
+	while (!word)
+	{
+		if (!wrd)
+		{
+			return InvalidIndex();
+		}
+		word = mWords[--wrd];
+	}
+	return Index(wrd * sWordBits + HighestSetBit(word));
+}
+
+void Bitmap::ShiftUpFrom(const Index index)
+{
+	if (index >= mSize)
+	{
+		return;
+	}
+
+	::std::size_t first = index / sWordBits;
+	unsigned int offset = index % sWordBits;
+
+	//Shift whole words, carrying the top bit of each word into the next, from the top down.
+	for (
+		::std::size_t wrd = mWords.size() - 1;
+		wrd > first;
+		--wrd
+		)
+	{
+		mWords[wrd] = (mWords[wrd] << 1) | (mWords[wrd - 1] >> (sWordBits - 1));
+	}
+
+	//Only the bits at or above index move in the first word.
+	Word below = offset ? mWords[first] & ((Word(1) << offset) - 1) : 0;
+	Word above = offset ? mWords[first] & ~((Word(1) << offset) - 1) : mWords[first];
+	mWords[first] = below | (above << 1);
+
+	//The new bit at index is always unset.
+	Unset(index);
+
+	//Drop anything shifted past mSize.
+	if (mSize % sWordBits)
+	{
+		mWords.back() &= (Word(1) << (mSize % sWordBits)) - 1;
+	}
+}
+
+Index Bitmap::Count() const
+{
+	Index ret = 0;
+	for (
+		::std::size_t wrd = 0;
+		wrd < mWords.size();
+		++wrd
+		)
+	{
+		ret += CountSetBits(mWords[wrd]);
+	}
+	return ret;
+}
+
+} //bio namespace
@@ -23,6 +23,7 @@
 #include "bio/common/container/Iterator.h"
 #include <limits>
 #include <algorithm>
+#include <new>
 
 namespace bio {
 
@@ -32,7 +33,10 @@ Container::Container(
 )
 	:
 	mFirstFree(1),
-	mSize(expectedSize + 1)
+	mSize(expectedSize + 1),
+	mOccupied(expectedSize + 1),
+	mAllocationCount(1),
+	mPeakBytes(mSize * stepSize)
 {
 	mStore = (unsigned char*)std::malloc(mSize * stepSize);
 	BIO_ASSERT(mStore)
@@ -42,7 +46,11 @@ Container::Container(const Container& other)
 	:
 	mFirstFree(other.mFirstFree),
 	mSize(other.mSize),
-	mDeallocated(other.mDeallocated)
+	mDeallocated(other.mDeallocated),
+	mOccupied(other.mOccupied),
+	mGrowthPolicy(other.mGrowthPolicy),
+	mAllocationCount(1),
+	mPeakBytes(mSize * other.GetStepSize())
 {
 	mStore = (unsigned char*)std::malloc(mSize * other.GetStepSize());
 	BIO_ASSERT(mStore)
@@ -56,7 +64,11 @@ Container::Container(const Container* other)
 	:
 	mFirstFree(other->mFirstFree),
 	mSize(other->mSize),
-	mDeallocated(other->mDeallocated)
+	mDeallocated(other->mDeallocated),
+	mOccupied(other->mOccupied),
+	mGrowthPolicy(other->mGrowthPolicy),
+	mAllocationCount(1),
+	mPeakBytes(mSize * other->GetStepSize())
 {
 	mStore = (unsigned char*)std::malloc(mSize * other->GetStepSize());
 	BIO_ASSERT(mStore)
@@ -79,32 +91,12 @@ Container::~Container()
 
 Index Container::GetBeginIndex() const
 {
-	Index ret = 1;
-	while (IsFree(ret))
-	{
-		if (!IsInRange(++ret))
-		{
-			return InvalidIndex();
-		}
-	}
-	return ret;
+	return GetNextAllocatedIndex(1);
 }
 
 Index Container::GetEndIndex() const
 {
-	Index ret = GetAllocatedSize();
-	if (!ret)
-	{
-		return InvalidIndex();
-	}
-	while (IsFree(ret))
-	{
-		if (!--ret)
-		{
-			return InvalidIndex();
-		}
-	}
-	return ret;
+	return GetPreviousAllocatedIndex(GetAllocatedSize());
 }
 
 Index Container::GetCapacity() const
@@ -128,6 +120,27 @@ bool Container::IsInRange(const Index index) const
 	return index && index <= GetCapacity();
 }
 
+Index Container::GetNextAllocatedIndex(const Index index) const
+{
+	//InvalidIndex is never allocated, so we can start searching from it.
+	Index ret = mOccupied.GetNextSet(index);
+	if (ret >= mFirstFree)
+	{
+		return InvalidIndex();
+	}
+	return ret;
+}
+
+Index Container::GetPreviousAllocatedIndex(const Index index) const
+{
+	//Nothing at or past mFirstFree is allocated.
+	if (index >= mFirstFree)
+	{
+		return mOccupied.GetPreviousSet(GetAllocatedSize());
+	}
+	return mOccupied.GetPreviousSet(index);
+}
+
 bool Container::IsFree(Index index) const
 {
 	//InvalidIndex should always be free.
@@ -141,11 +154,7 @@ bool Container::IsFree(Index index) const
 		return true;
 	}
 
-	return ::std::find(
-		mDeallocated.begin(),
-		mDeallocated.end(),
-		index
-	) != mDeallocated.end();
+	return !mOccupied.IsSet(index);
 }
 
 bool Container::IsAllocated(const Index index) const
@@ -155,19 +164,80 @@ bool Container::IsAllocated(const Index index) const
 
 void Container::Expand()
 {
-	//IMPORTANT: ASSUME 
 	BIO_SANITIZE(mSize != ::std::numeric_limits< Index >::max(), ,
 		return)
-	Index targetSize = mSize * mSize; //squared. 
+	Reallocate(mGrowthPolicy.GetNextSize(mSize));
+}
+
+bool Container::Reserve(const Index capacity)
+{
+	if (capacity <= GetCapacity())
+	{
+		return true;
+	}
+	BIO_SANITIZE(capacity != ::std::numeric_limits< Index >::max(), ,
+		return false)
+	return Reallocate(capacity + 1);
+}
+
+void Container::ShrinkToFit()
+{
+	//Forget any deallocated Indices at the end of *this, so that we don't keep their memory around.
+	while (GetAllocatedSize() && IsFree(GetAllocatedSize()))
+	{
+		mDeallocated.erase(::std::find(
+			mDeallocated.begin(),
+			mDeallocated.end(),
+			GetAllocatedSize()));
+		--mFirstFree;
+	}
+
+	//Always keep room for InvalidIndex and 1 more.
+	Index targetSize = mFirstFree < 2 ? 2 : mFirstFree;
 	if (targetSize < mSize)
 	{
-		targetSize = ::std::numeric_limits< Index >::max();
+		Reallocate(targetSize);
 	}
-	mStore = (unsigned char*)std::realloc(
+}
+
+void Container::SetGrowthPolicy(const GrowthPolicy& policy)
+{
+	mGrowthPolicy = policy;
+}
+
+const GrowthPolicy& Container::GetGrowthPolicy() const
+{
+	return mGrowthPolicy;
+}
+
+Index Container::GetAllocationCount() const
+{
+	return mAllocationCount;
+}
+
+::std::size_t Container::GetPeakBytes() const
+{
+	return mPeakBytes;
+}
+
+bool Container::Reallocate(const Index size)
+{
+	BIO_SANITIZE(size >= mFirstFree, ,
+		return false)
+	unsigned char* reallocated = (unsigned char*)std::realloc(
 		mStore,
-		targetSize * GetStepSize());
-	mSize = targetSize;
-	BIO_SANITIZE(mStore, ,return)
+		size * GetStepSize());
+	BIO_SANITIZE(reallocated, ,
+		return false)
+	mStore = reallocated;
+	mSize = size;
+	mOccupied.Resize(mSize);
+	++mAllocationCount;
+	if (mSize * GetStepSize() > mPeakBytes)
+	{
+		mPeakBytes = mSize * GetStepSize();
+	}
+	return true;
 }
 
 Index Container::Add(const ByteStream content)
@@ -203,24 +273,27 @@ Index Container::Insert(
 		Expand();
 	}
 
-	//adjust all deallocated positions.
-	std::deque< Index > adjustedDeallocations;
+	//adjust all deallocated positions at or after the insertion point.
 	for (
 		std::deque< Index >::iterator dlc = mDeallocated.begin();
 		dlc != mDeallocated.end();
 		++dlc
 		)
 	{
-		adjustedDeallocations.push_front(*dlc + 1);
+		if (*dlc >= index)
+		{
+			++(*dlc);
+		}
 	}
 
 	//move all memory down 1.
-	std::memcpy(
-		&mStore[index * GetStepSize()],
+	std::memmove(
 		&mStore[(index + 1) * GetStepSize()],
+		&mStore[index * GetStepSize()],
 		(mFirstFree - index) * GetStepSize());
+	mOccupied.ShiftUpFrom(index);
+	++mFirstFree;
 
-	mDeallocated = adjustedDeallocations;
 	mDeallocated.push_front(index); //make sure we add to the desired index.
 
 	//add the content.
@@ -241,24 +314,21 @@ const ByteStream Container::Access(const Index index) const
 
 Index Container::SeekTo(const ByteStream content) const
 {
-	Index ret = InvalidIndex();
-	Iterator* itt = ConstructClassIterator();
-	itt->MoveTo(GetEndIndex());
 	for (
-		; !itt->IsBeforeBeginning();
-		itt->Decrement())
+		SmartIterator itt = End();
+		!itt.IsBeforeBeginning();
+		--itt
+		)
 	{
 		if (AreEqual(
-			itt->GetIndex(),
+			itt.GetIndex(),
 			content
 		))
 		{
-			ret = itt->GetIndex();
-			break;
+			return itt.GetIndex();
 		}
 	}
-	delete itt;
-	return ret;
+	return InvalidIndex();
 }
 
 bool Container::Has(const ByteStream content) const
@@ -272,6 +342,7 @@ ByteStream Container::Erase(const Index index)
 	BIO_SANITIZE(this->IsAllocated(index), , return ret)
 	ret = Access(index);
 	this->mDeallocated.push_back(index);
+	this->mOccupied.Unset(index);
 	return ret;
 }
 
@@ -297,15 +368,26 @@ void Container::Clear()
 {
 	mFirstFree = 1;
 	mDeallocated.clear();
+	mOccupied.Clear();
 }
 
-Iterator* Container::ConstructClassIterator(const Index index) const
+Iterator* Container::ConstructClassIterator(
+	const Index index,
+	void* storage,
+	const ::std::size_t storageSize
+) const
 {
-	Iterator* ret = new Iterator(
+	if (storage && storageSize >= sizeof(Iterator))
+	{
+		return new(storage) Iterator(
+			this,
+			index
+		);
+	}
+	return new Iterator(
 		this,
 		index
 	);
-	return ret;
 }
 
 SmartIterator Container::Begin() const
@@ -359,6 +441,7 @@ Index Container::GetNextAvailableIndex()
 	{
 		ret = mFirstFree++;
 	}
+	mOccupied.Set(ret);
 	return ret;
 }
 
@@ -0,0 +1,103 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2022 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "bio/common/container/GrowthPolicy.h"
+#include "bio/common/macro/Macros.h"
+#include <limits>
+
+namespace bio {
+
+/*static*/ GrowthPolicy GrowthPolicy::Geometric(float factor)
+{
+	GrowthPolicy ret;
+	ret.mMode = GEOMETRIC;
+	ret.mFactor = factor > 1.0f ? factor : 2.0f;
+	return ret;
+}
+
+/*static*/ GrowthPolicy GrowthPolicy::FixedStep(Index step)
+{
+	GrowthPolicy ret;
+	ret.mMode = FIXED_STEP;
+	ret.mStep = step ? step : 1;
+	return ret;
+}
+
+/*static*/ GrowthPolicy GrowthPolicy::Custom(Function function)
+{
+	GrowthPolicy ret;
+	BIO_SANITIZE(function, , return ret)
+	ret.mMode = CUSTOM;
+	ret.mFunction = function;
+	return ret;
+}
+
+GrowthPolicy::GrowthPolicy()
+	:
+	mMode(GEOMETRIC),
+	mFactor(2.0f),
+	mStep(1),
+	mFunction(NULL)
+{
+
+}
+
+GrowthPolicy::Mode GrowthPolicy::GetMode() const
+{
+	return mMode;
+}
+
+Index GrowthPolicy::GetNextSize(const Index currentSize) const
+{
+	const Index max = ::std::numeric_limits< Index >::max();
+	if (currentSize == max)
+	{
+		return max;
+	}
+
+	double target = currentSize;
+	switch (mMode)
+	{
+		case FIXED_STEP:
+			target += mStep;
+			break;
+		case CUSTOM:
+			target = mFunction(currentSize);
+			break;
+		case GEOMETRIC:
+		default:
+			target *= mFactor;
+			break;
+	}
+
+	//Always grow by at least 1 and never overflow.
+	if (target <= currentSize)
+	{
+		target = double(currentSize) + 1;
+	}
+	if (target > max)
+	{
+		return max;
+	}
+	return Index(target);
+}
+
+} //bio namespace
@@ -45,6 +45,11 @@ Index Iterator::GetIndex() const
 	return mIndex;
 }
 
+const Container* Iterator::GetContainer() const
+{
+	return mContainer;
+}
+
 bool Iterator::MoveTo(const Index index)
 {
 	if (mContainer->IsAllocated(index))
@@ -71,10 +76,13 @@ Iterator& Iterator::Increment()
 	{
 		return *this;
 	}
-	while (mContainer->IsFree(++mIndex) && !IsAfterEnd())
+	Index next = mContainer->GetNextAllocatedIndex(mIndex + 1);
+	if (!next)
 	{
-		continue; //avoid re-referencing mIndex; see condition.
+		//Move past the end so that IsAfterEnd() is true.
+		next = mContainer->GetAllocatedSize() + 1;
 	}
+	mIndex = next;
 	return *this;
 }
 
@@ -84,10 +92,7 @@ Iterator& Iterator::Decrement()
 	{
 		return *this;
 	}
-	while (mContainer->IsFree(--mIndex) && !IsBeforeBeginning())
-	{
-		continue; //avoid re-referencing mIndex; see condition.
-	}
+	mIndex = mContainer->GetPreviousAllocatedIndex(mIndex - 1); //InvalidIndex() if we've passed the beginning.
 	return *this;
 }
 
@@ -27,9 +27,11 @@ namespace bio {
 
 SmartIterator::SmartIterator(const Container* container)
 	:
-	mImplementation(container->ConstructClassIterator(container->GetEndIndex()))
+	mImplementation(NULL)
 {
-
+	Construct(
+		container,
+		container->GetEndIndex());
 }
 
 SmartIterator::SmartIterator(
@@ -37,14 +39,39 @@ SmartIterator::SmartIterator(
 	Index index
 )
 	:
-	mImplementation(container->ConstructClassIterator(index))
+	mImplementation(NULL)
 {
+	Construct(
+		container,
+		index
+	);
+}
 
+SmartIterator::SmartIterator(const SmartIterator& toCopy)
+	:
+	mImplementation(NULL)
+{
+	Construct(
+		toCopy.mImplementation->GetContainer(),
+		toCopy.GetIndex());
 }
 
 SmartIterator::~SmartIterator()
 {
-	delete mImplementation;
+	Destruct();
+}
+
+SmartIterator& SmartIterator::operator=(const SmartIterator& toCopy)
+{
+	if (&toCopy == this)
+	{
+		return *this;
+	}
+	Destruct();
+	Construct(
+		toCopy.mImplementation->GetContainer(),
+		toCopy.GetIndex());
+	return *this;
 }
 
 bool SmartIterator::IsValid() const
@@ -123,4 +150,33 @@ SmartIterator SmartIterator::operator--(int) const
 	return ret;
 }
 
+void SmartIterator::Construct(
+	const Container* container,
+	Index index
+)
+{
+	mImplementation = container->ConstructClassIterator(
+		index,
+		mBuffer,
+		sInlineCapacity
+	);
+}
+
+void SmartIterator::Destruct()
+{
+	if (!mImplementation)
+	{
+		return;
+	}
+	if ((void*)mImplementation == (void*)mBuffer)
+	{
+		mImplementation->~Iterator();
+	}
+	else
+	{
+		delete mImplementation;
+	}
+	mImplementation = NULL;
+}
+
 } //bio namespace
@@ -0,0 +1,219 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2022 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "bio/common/memory/MappedFile.h"
+#include <cstdio>
+
+//@formatter:off
+#if defined(BIO_OS_IS_UNIX) || defined(BIO_OS_IS_APPLE)
+	#define BIO_MAPPED_FILE_USES_MMAP 1
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+//@formatter:on
+
+namespace bio {
+
+MappedFile::MappedFile()
+	:
+	mData(NULL),
+	mSize(0),
+	mIsMapped(false)
+{
+}
+
+MappedFile::MappedFile(const char* path)
+	:
+	mData(NULL),
+	mSize(0),
+	mIsMapped(false)
+{
+	Open(path);
+}
+
+MappedFile::~MappedFile()
+{
+	Close();
+}
+
+bool MappedFile::Open(const char* path)
+{
+	Close();
+	BIO_SANITIZE(path, , return false)
+
+	#ifdef BIO_MAPPED_FILE_USES_MMAP
+	int file = open(
+		path,
+		O_RDONLY
+	);
+	if (file < 0)
+	{
+		return false;
+	}
+	struct stat status;
+	if (fstat(
+		file,
+		&status
+	) || status.st_size <= 0)
+	{
+		close(file);
+		return false;
+	}
+	void* mapping = mmap(
+		NULL,
+		status.st_size,
+		PROT_READ,
+		MAP_PRIVATE,
+		file,
+		0
+	);
+	close(file); //the mapping keeps the file open.
+	if (mapping == MAP_FAILED)
+	{
+		return false;
+	}
+	mData = static_cast< const unsigned char* >(mapping);
+	mSize = status.st_size;
+	mIsMapped = true;
+	return true;
+	#else
+	::std::FILE* file = ::std::fopen(
+		path,
+		"rb"
+	);
+	if (!file)
+	{
+		return false;
+	}
+	long size = -1;
+	if (!::std::fseek(
+		file,
+		0,
+		SEEK_END
+	))
+	{
+		size = ::std::ftell(file);
+	}
+	if (size <= 0 || ::std::fseek(
+		file,
+		0,
+		SEEK_SET
+	))
+	{
+		::std::fclose(file);
+		return false;
+	}
+	//operator new is aligned for any type, unlike new unsigned char[].
+	unsigned char* buffer = static_cast< unsigned char* >(::operator new(size));
+	bool isComplete = ::std::fread(
+		buffer,
+		1,
+		size,
+		file
+	) == ::std::size_t(size);
+	::std::fclose(file);
+	if (!isComplete)
+	{
+		::operator delete(buffer);
+		return false;
+	}
+	mData = buffer;
+	mSize = size;
+	mIsMapped = false;
+	return true;
+	#endif
+}
+
+void MappedFile::Close()
+{
+	if (!mData)
+	{
+		return;
+	}
+	#ifdef BIO_MAPPED_FILE_USES_MMAP
+	if (mIsMapped)
+	{
+		munmap(
+			const_cast< unsigned char* >(mData),
+			mSize
+		);
+	}
+	else
+	{
+		::operator delete(const_cast< unsigned char* >(mData));
+	}
+	#else
+	::operator delete(const_cast< unsigned char* >(mData));
+	#endif
+	mData = NULL;
+	mSize = 0;
+	mIsMapped = false;
+}
+
+bool MappedFile::IsOpen() const
+{
+	return mData != NULL;
+}
+
+bool MappedFile::IsMapped() const
+{
+	return mIsMapped;
+}
+
+const unsigned char* MappedFile::GetData() const
+{
+	return mData;
+}
+
+::std::size_t MappedFile::GetSize() const
+{
+	return mSize;
+}
+
+/*static*/ bool MappedFile::Write(
+	const char* path,
+	const void* data,
+	::std::size_t size
+)
+{
+	BIO_SANITIZE(path && (data || !size), , return false)
+
+	::std::FILE* file = ::std::fopen(
+		path,
+		"wb"
+	);
+	if (!file)
+	{
+		return false;
+	}
+	bool ret = ::std::fwrite(
+		data,
+		1,
+		size,
+		file
+	) == size;
+	ret = !::std::fclose(file) && ret;
+	return ret;
+}
+
+} //bio namespace
@@ -0,0 +1,158 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2022 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "bio/common/memory/ObjectPool.h"
+
+namespace bio {
+
+ObjectPool::ObjectPool(
+	const ::std::size_t blockSize,
+	const Index blocksPerSlab
+)
+	:
+	mBlockSize(blockSize),
+	mBlocksPerSlab(blocksPerSlab ? blocksPerSlab : 1),
+	mFree(NULL),
+	mNumberOfFree(0)
+{
+	//Every block must be able to hold the next pointer of the free list and be aligned for anything.
+	const ::std::size_t alignment = 2 * sizeof(void*);
+	if (mBlockSize < sizeof(void*))
+	{
+		mBlockSize = sizeof(void*);
+	}
+	mBlockSize = (mBlockSize + alignment - 1) / alignment * alignment;
+}
+
+ObjectPool::~ObjectPool()
+{
+	LockThread();
+	for (
+		::std::vector< void* >::iterator slb = mSlabs.begin();
+		slb != mSlabs.end();
+		++slb
+		)
+	{
+		::operator delete(*slb);
+	}
+	mSlabs.clear();
+	mFree = NULL;
+	mNumberOfFree = 0;
+	UnlockThread();
+}
+
+void ObjectPool::Release(ObjectPoolCache* cache)
+{
+	Drain(
+		cache,
+		cache->mCount
+	);
+}
+
+::std::size_t ObjectPool::GetBlockSize() const
+{
+	return mBlockSize;
+}
+
+Index ObjectPool::GetNumberOfBlocks() const
+{
+	LockThread();
+	Index ret = mSlabs.size() * mBlocksPerSlab;
+	UnlockThread();
+	return ret;
+}
+
+Index ObjectPool::GetNumberOfFreeBlocks() const
+{
+	LockThread();
+	Index ret = mNumberOfFree;
+	UnlockThread();
+	return ret;
+}
+
+void ObjectPool::Refill(ObjectPoolCache* cache)
+{
+	LockThread();
+	if (!mFree)
+	{
+		unsigned char* slab = static_cast< unsigned char* >(::operator new(mBlockSize * mBlocksPerSlab));
+		mSlabs.push_back(slab);
+
+		//Link the new blocks in order, so that consecutive Allocate()s are near each other in memory.
+		for (
+			Index blk = mBlocksPerSlab;
+			blk > 0;
+			--blk
+			)
+		{
+			void* block = slab + (blk - 1) * mBlockSize;
+			*static_cast< void** >(block) = mFree;
+			mFree = block;
+		}
+		mNumberOfFree += mBlocksPerSlab;
+	}
+
+	for (
+		Index moved = 0;
+		moved < sBatchSize && mFree;
+		++moved
+		)
+	{
+		void* block = mFree;
+		mFree = *static_cast< void** >(block);
+		*static_cast< void** >(block) = cache->mHead;
+		cache->mHead = block;
+		++cache->mCount;
+		--mNumberOfFree;
+	}
+	UnlockThread();
+}
+
+void ObjectPool::Drain(
+	ObjectPoolCache* cache,
+	Index count
+)
+{
+	if (!count || !cache->mHead)
+	{
+		return;
+	}
+
+	//Find the last block to move without holding the lock.
+	void* first = cache->mHead;
+	void* last = first;
+	Index moved = 1;
+	while (moved < count && *static_cast< void** >(last))
+	{
+		last = *static_cast< void** >(last);
+		++moved;
+	}
+	cache->mHead = *static_cast< void** >(last);
+	cache->mCount -= moved;
+
+	LockThread();
+	*static_cast< void** >(last) = mFree;
+	mFree = first;
+	mNumberOfFree += moved;
+	UnlockThread();
+}
+
+} //bio namespace
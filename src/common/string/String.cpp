@@ -20,9 +20,119 @@
  */
 
 #include "bio/common/string/String.h"
+#include <new>
+
+//@formatter:off
+#if BIO_CPP_VERSION >= 11
+	#include <atomic>
+#endif
+//@formatter:on
 
 namespace bio {
 
+/**
+ * The header of a buffer of characters which may be owned by many Strings. <br />
+ * The characters (plus a terminating '\0') are allocated immediately after the Share. <br />
+ */
+struct String::Share
+{
+	/**
+	 * @param source
+	 * @param length
+	 * @return a new Share holding a copy of length characters from source and owned once.
+	 */
+	static Share* Create(const char* source, ::std::size_t length)
+	{
+		Share* ret = new(::operator new(sizeof(Share) + length + 1)) Share();
+		char* data = ret->GetData();
+		if (source)
+		{
+			std::memcpy(
+				data,
+				source,
+				length
+			);
+		}
+		data[length] = '\0';
+		return ret;
+	}
+
+	Share()
+		:
+		mCount(1)
+	{
+
+	}
+
+	/**
+	 * @return the characters *this holds.
+	 */
+	char* GetData()
+	{
+		return reinterpret_cast< char* >(this + 1);
+	}
+
+	/**
+	 * Add an owner to *this.
+	 */
+	void Acquire()
+	{
+		//@formatter:off
+		#if BIO_CPP_VERSION >= 11
+			mCount.fetch_add(1, ::std::memory_order_relaxed);
+		#elif defined(__GNUC__)
+			__sync_add_and_fetch(&mCount, 1);
+		#else
+			++mCount;
+		#endif
+		//@formatter:on
+	}
+
+	/**
+	 * Remove an owner from *this. <br />
+	 * The last owner deletes *this. <br />
+	 */
+	void Abandon()
+	{
+		//@formatter:off
+		#if BIO_CPP_VERSION >= 11
+			bool isLast = mCount.fetch_sub(1, ::std::memory_order_acq_rel) == 1;
+		#elif defined(__GNUC__)
+			bool isLast = !__sync_sub_and_fetch(&mCount, 1);
+		#else
+			bool isLast = !--mCount;
+		#endif
+		//@formatter:on
+		if (isLast)
+		{
+			this->~Share();
+			::operator delete(this);
+		}
+	}
+
+	/**
+	 * @return whether or not *this has more than 1 owner.
+	 */
+	bool IsShared() const
+	{
+		//@formatter:off
+		#if BIO_CPP_VERSION >= 11
+			return mCount.load(::std::memory_order_acquire) > 1;
+		#else
+			return mCount > 1;
+		#endif
+		//@formatter:on
+	}
+
+	//@formatter:off
+	#if BIO_CPP_VERSION >= 11
+		::std::atomic< uint32_t > mCount;
+	#else
+		volatile uint32_t mCount;
+	#endif
+	//@formatter:on
+};
+
 /*static*/ const char* String::GetCloneOf(const char* source, ::std::size_t length)
 {
 	BIO_SANITIZE(source, , return NULL)
@@ -48,67 +158,84 @@ namespace bio {
 	switch(desiredMode)
 	{
 		case READ_ONLY:
-			ret.mMode = READ_ONLY;
 			ret.mString = string.mString;
 			ret.mLength = string.mLength;
 			break;
 		case COPY_ON_WRITE:
-			ret.mMode = COPY_ON_WRITE;
-			ret.mString = string.mString;
-			ret.mLength = string.mLength;
+			ret.ShareWith(string);
 			break;
 		case READ_WRITE:
-			ret.mMode = READ_WRITE;
-			ret.mString = GetCloneOf(string.mString, string.mLength);
-			ret.mLength = string.mLength;
+			if (string.mShare)
+			{
+				ret.ShareWith(string);
+			}
+			else if (string.mString)
+			{
+				ret.Own(
+					string.mString,
+					string.mLength
+				);
+			}
 			break;
 		default:
-			break;
+			return ret;
 	}
+	ret.mMode = desiredMode;
 	return ret;
 }
 
 String::String(Mode mode) :
 	ImmutableString(NULL, 0),
-	mMode(mode)
+	mMode(mode),
+	mShare(NULL)
 {
 
 }
 
 String::String(const char* string) :
 	ImmutableString(string, string ? strlen(string) : 0),
-	mMode(READ_ONLY)
+	mMode(READ_ONLY),
+	mShare(NULL)
 {
 
 }
 
-String::String(::std::string string) :
-	ImmutableString(GetCloneOf(string.c_str()), strlen(mString)),
-	mMode(READ_WRITE)
+String::String(const ::std::string& string) :
+	ImmutableString(NULL, 0),
+	mMode(READ_WRITE),
+	mShare(NULL)
 {
-
+	Own(
+		string.c_str(),
+		string.size()
+	);
 }
 
 String::String(const ImmutableString& string):
 	ImmutableString(string.mString, string.mLength),
-	mMode(READ_ONLY)
+	mMode(READ_ONLY),
+	mShare(NULL)
 {
 
 }
 
 String::String(const String& toCopy) :
-	ImmutableString(toCopy.mMode == READ_WRITE ? GetCloneOf(toCopy.mString) : toCopy.mString, toCopy.mLength),
-	mMode(toCopy.mMode)
+	ImmutableString(NULL, 0),
+	mMode(toCopy.mMode),
+	mShare(NULL)
 {
-
+	ShareWith(toCopy);
 }
 
 #if BIO_CPP_VERSION >= 11
-String::String(const String&& toMove):
+String::String(String&& toMove):
 	ImmutableString(toMove.mString, toMove.mLength),
-	mMode(toMove.mMode)
+	mMode(toMove.mMode),
+	mShare(toMove.mShare)
 {
-
+	toMove.mString = NULL;
+	toMove.mLength = 0;
+	toMove.mShare = NULL;
 }
 #endif
 
@@ -120,46 +247,52 @@ String::~String()
 }
 
 #if BIO_CPP_VERSION >= 11
-String& String::operator=(const String&& toMove)
+String& String::operator=(String&& toMove)
 {
+	if (&toMove == this)
+	{
+		return *this;
+	}
 	Clear();
 	mString = toMove.mString;
 	mMode = toMove.mMode;
 	mLength = toMove.mLength;
-	const_cast< String* >(&toMove)->mMode = INVALID; // don't delete the mString we just assigned elsewhere.
+	mShare = toMove.mShare;
+	toMove.mString = NULL;
+	toMove.mLength = 0;
+	toMove.mShare = NULL;
 	return *this;
 }
 #endif
 
 String& String::operator=(const String& toCopy)
 {
-	switch(mMode)
+	if (&toCopy == this)
 	{
-		case READ_WRITE:
-			Clear();
-			mString = GetCloneOf(toCopy.mString, toCopy.mLength);
-			break;
-
-		default:
-			mString = toCopy.mString;
-			break;
+		return *this;
+	}
+	if (mMode == READ_WRITE && !toCopy.mShare && toCopy.mString)
+	{
+		Own(
+			toCopy.mString,
+			toCopy.mLength
+		);
+	}
+	else
+	{
+		ShareWith(toCopy);
 	}
-	mLength = toCopy.mLength;
-
 	return *this;
 }
 
 const String& String::operator=(const String& toMoveHack) const
 {
 	String* hack = const_cast< String* >(this);
-	if (mMode == READ_WRITE && mString)
+	if (&toMoveHack != this)
 	{
-		delete[] hack->mString;
+		hack->ShareWith(toMoveHack);
 	}
-
-	hack->mString = toMoveHack.mString;
 	hack->mMode = toMoveHack.mMode;
-	hack->mLength = toMoveHack.mLength;
 	return *this;
 }
 
@@ -168,44 +301,48 @@ String& String::operator=(const ImmutableString& toAssign)
 	switch(mMode)
 	{
 		case READ_WRITE:
-			Clear();
-			mString = GetCloneOf(toAssign.mString, toAssign.mLength);
+			Own(
+				toAssign.mString,
+				toAssign.mLength
+			);
 			break;
 
 		default:
+			Clear();
 			mString = toAssign.mString;
+			mLength = toAssign.mLength;
 			break;
 	}
-	mLength = toAssign.mLength;
 
 	return *this;
 }
 
 String& String::operator=(const char* string)
 {
-	switch(mMode)
+	if (mMode == READ_WRITE && string)
 	{
-		case READ_WRITE:
-			Clear();
-			mString = GetCloneOf(string);
-			mLength = strlen(mString);
-			break;
-
-		default:
-			mString = string;
-			mLength = strlen(mString);
-			break;
+		Own(
+			string,
+			strlen(string)
+		);
+	}
+	else
+	{
+		Clear();
+		mString = string;
+		mLength = string ? strlen(string) : 0;
 	}
 
 	return *this;
 }
 
-String& String::operator=(::std::string string)
+String& String::operator=(const ::std::string& string)
 {
-	Clear();
-	mString = GetCloneOf(string.c_str());
+	Own(
+		string.c_str(),
+		string.size()
+	);
 	mMode = READ_WRITE;
-	mLength = strlen(mString);
 	return *this;
 }
 
@@ -219,6 +356,10 @@ bool String::operator==(const ImmutableString& other) const
 	{
 		return false;
 	}
+	if (mString == other.mString) //e.g. a shared buffer.
+	{
+		return true;
+	}
 	return !strncmp(mString, other.mString, mLength);
 }
 
@@ -232,6 +373,10 @@ bool String::operator==(const String& other) const
 	{
 		return false;
 	}
+	if (mString == other.mString) //e.g. a shared buffer.
+	{
+		return true;
+	}
 	return !strncmp(mString, other.mString, mLength);
 }
 
@@ -241,7 +386,8 @@ bool String::operator==(const char* other) const
 	{
 		return mString == other;
 	}
-	return !strncmp(mString, other, mLength);
+	//If other is shorter than *this, strncmp will stop at its end, so we never read past it.
+	return !strncmp(mString, other, mLength) && other[mLength] == '\0';
 }
 
 bool String::operator==(const ::std::string& other) const
@@ -257,9 +403,26 @@ bool String::operator==(const ::std::string& other) const
 	return !strncmp(mString, other.c_str(), mLength);
 }
 
+bool String::IsEqualInsensitive(const ImmutableString& other) const
+{
+	if (!other.mString || !mString) //one is NULL. Are they both?
+	{
+		return mString == other.mString;
+	}
+	if (mLength != other.mLength)
+	{
+		return false;
+	}
+	if (mString == other.mString) //e.g. a shared buffer.
+	{
+		return true;
+	}
+	return !strncasecmp(mString, other.mString, mLength);
+}
+
 String::operator ::std::string() const
 {
-	return ::std::string(mString).substr(0, mLength);
+	return AsStdString();
 }
 
 String::operator bool() const
@@ -272,6 +435,27 @@ String::Mode String::GetMode() const
 	return mMode;
 }
 
+bool String::IsShared() const
+{
+	return mShare && mShare->IsShared();
+}
+
+char* String::GetWritableString()
+{
+	BIO_SANITIZE(mMode == READ_WRITE || mMode == COPY_ON_WRITE, , return NULL)
+	BIO_SANITIZE(mString, , return NULL)
+
+	if (!mShare || mShare->IsShared())
+	{
+		Own(
+			mString,
+			mLength
+		);
+	}
+	mMode = READ_WRITE;
+	return mShare->GetData();
+}
+
 String String::SubString(::std::size_t start, ::std::size_t length) const
 {
 	String ret(GetImmutableSubString(start, length));
@@ -281,7 +465,14 @@ String String::SubString(::std::size_t start, ::std::size_t length) const
 
 ::std::string String::AsStdString() const
 {
-	return ::std::string(mString);
+	if (!mString)
+	{
+		return ::std::string();
+	}
+	return ::std::string(
+		mString,
+		mLength
+	);
 }
 
 const char* String::AsCharString() const
@@ -335,12 +526,39 @@ float String::AsFloat() const
 	);
 }
 
+void String::Own(const char* source, ::std::size_t length)
+{
+	//source may belong to *this, so copy it before Clear()ing.
+	Share* share = Share::Create(
+		source,
+		length
+	);
+	Clear();
+	mShare = share;
+	mString = share->GetData();
+	mLength = length;
+}
+
+void String::ShareWith(const String& other)
+{
+	if (other.mShare)
+	{
+		other.mShare->Acquire();
+	}
+	Clear();
+	mShare = other.mShare;
+	mString = other.mString;
+	mLength = other.mLength;
+}
+
 void String::Clear()
 {
-	if (mMode == READ_WRITE && mString)
+	if (mShare)
 	{
-		delete[] mString;
+		mShare->Abandon();
+		mShare = NULL;
 		mString = NULL;
+		mLength = 0;
 	}
 }
 
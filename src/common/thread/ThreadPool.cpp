@@ -0,0 +1,591 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2022 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "bio/common/thread/ThreadPool.h"
+#include "bio/common/thread/Threaded.h"
+#include <stdexcept>
+
+//@formatter:off
+#if BIO_CPP_VERSION < 11
+	#ifdef BIO_OS_IS_LINUX
+		#include <sched.h>
+		#include <unistd.h>
+	#endif
+#else
+	#include <condition_variable>
+	#include <mutex>
+	#include <thread>
+#endif
+//@formatter:on
+
+namespace bio {
+
+/**
+ * The state shared by all Chunks of 1 Distribute() call. <br />
+ */
+struct ThreadPoolImplementation::Job :
+	public ThreadSafe
+{
+	ParallelWork* mWork;
+	Index mRemaining; //Chunks not yet done.
+	bool mFailed;
+	::std::string mFailure;
+};
+
+/**
+ * Where idle Workers wait for more Chunks. <br />
+ * mGeneration changes every time Chunks are Pushed, so a Worker which found no Chunks can tell whether any have been Pushed since it Look()ed. <br />
+ * Workers only exist where there is something to lock with (see Start()), so there is no Parking without c++11 or pthreads. <br />
+ */
+struct ThreadPoolImplementation::Parking
+{
+	Parking()
+		:
+		mGeneration(0),
+		mIsStopping(false)
+	{
+		//@formatter:off
+		#if BIO_CPP_VERSION < 11 && defined(BIO_OS_IS_LINUX)
+			pthread_mutex_init(&mMutex, NULL);
+			pthread_cond_init(&mCondition, NULL);
+		#endif
+		//@formatter:on
+	}
+
+	~Parking()
+	{
+		//@formatter:off
+		#if BIO_CPP_VERSION < 11 && defined(BIO_OS_IS_LINUX)
+			pthread_cond_destroy(&mCondition);
+			pthread_mutex_destroy(&mMutex);
+		#endif
+		//@formatter:on
+	}
+
+	/**
+	 * @return the current generation, to be given to Wait().
+	 */
+	Index Look()
+	{
+		Lock();
+		Index ret = mGeneration;
+		Unlock();
+		return ret;
+	}
+
+	/**
+	 * Sleep until Chunks have been Pushed since the given generation or until Stop(). <br />
+	 * @param seen what Look() returned before looking for Chunks.
+	 * @return false if Stop()ing; true otherwise.
+	 */
+	bool Wait(Index seen)
+	{
+		//@formatter:off
+		#if BIO_CPP_VERSION >= 11
+			::std::unique_lock< ::std::mutex > lock(mMutex);
+			while (mGeneration == seen && !mIsStopping)
+			{
+				mCondition.wait(lock);
+			}
+			return !mIsStopping;
+		#elif defined(BIO_OS_IS_LINUX)
+			pthread_mutex_lock(&mMutex);
+			while (mGeneration == seen && !mIsStopping)
+			{
+				pthread_cond_wait(&mCondition, &mMutex);
+			}
+			bool ret = !mIsStopping;
+			pthread_mutex_unlock(&mMutex);
+			return ret;
+		#else
+			return true;
+		#endif
+		//@formatter:on
+	}
+
+	/**
+	 * Wake all Workers, since there are new Chunks. <br />
+	 */
+	void Wake()
+	{
+		Lock();
+		++mGeneration;
+		Unlock();
+		NotifyAll();
+	}
+
+	/**
+	 * Wake all Workers and keep them from Wait()ing until Resume(). <br />
+	 */
+	void Stop()
+	{
+		Lock();
+		mIsStopping = true;
+		Unlock();
+		NotifyAll();
+	}
+
+	/**
+	 * Let Workers Wait() again. <br />
+	 */
+	void Resume()
+	{
+		Lock();
+		mIsStopping = false;
+		Unlock();
+	}
+
+	void Lock()
+	{
+		//@formatter:off
+		#if BIO_CPP_VERSION >= 11
+			mMutex.lock();
+		#elif defined(BIO_OS_IS_LINUX)
+			pthread_mutex_lock(&mMutex);
+		#endif
+		//@formatter:on
+	}
+
+	void Unlock()
+	{
+		//@formatter:off
+		#if BIO_CPP_VERSION >= 11
+			mMutex.unlock();
+		#elif defined(BIO_OS_IS_LINUX)
+			pthread_mutex_unlock(&mMutex);
+		#endif
+		//@formatter:on
+	}
+
+	void NotifyAll()
+	{
+		//@formatter:off
+		#if BIO_CPP_VERSION >= 11
+			mCondition.notify_all();
+		#elif defined(BIO_OS_IS_LINUX)
+			pthread_cond_broadcast(&mCondition);
+		#endif
+		//@formatter:on
+	}
+
+	Index mGeneration;
+	bool mIsStopping;
+
+	//@formatter:off
+	#if BIO_CPP_VERSION >= 11
+		::std::mutex mMutex;
+		::std::condition_variable mCondition;
+	#elif defined(BIO_OS_IS_LINUX)
+		pthread_mutex_t mMutex;
+		pthread_cond_t mCondition;
+	#endif
+	//@formatter:on
+};
+
+/**
+ * Workers are the threads of a ThreadPool. <br />
+ * The Chunks in mChunks are guarded by the lock of *this. <br />
+ */
+class ThreadPoolImplementation::Worker :
+	public Threaded
+{
+public:
+	/**
+	 * @param pool
+	 */
+	Worker(ThreadPoolImplementation* pool)
+		:
+		mPool(pool)
+	{
+	}
+
+	/**
+	 *
+	 */
+	virtual ~Worker()
+	{
+	}
+
+	/**
+	 * Do 1 Chunk, from *this or any other Worker; if there are none, sleep until more are Distribute()d. <br />
+	 * @return false once the pool is Stop()ing; true otherwise.
+	 */
+	virtual bool Work()
+	{
+		sCurrentWorker = this;
+		//Look before looking for Chunks, so that any Pushed after we found none will keep us awake.
+		Index seen = mPool->mParking->Look();
+		if (!mPool->DoChunk(this))
+		{
+			return mPool->mParking->Wait(seen);
+		}
+		return true;
+	}
+
+	/**
+	 * @param chunk
+	 */
+	void Push(const Chunk& chunk)
+	{
+		LockThread();
+		mChunks.push_back(chunk);
+		UnlockThread();
+	}
+
+	/**
+	 * Take the most recently Pushed Chunk. <br />
+	 * @param chunk
+	 * @return whether or not a Chunk was taken.
+	 */
+	bool PopBack(Chunk& chunk)
+	{
+		LockThread();
+		bool ret = !mChunks.empty();
+		if (ret)
+		{
+			chunk = mChunks.back();
+			mChunks.pop_back();
+		}
+		UnlockThread();
+		return ret;
+	}
+
+	/**
+	 * Take the least recently Pushed Chunk. <br />
+	 * @param chunk
+	 * @return whether or not a Chunk was taken.
+	 */
+	bool PopFront(Chunk& chunk)
+	{
+		LockThread();
+		bool ret = !mChunks.empty();
+		if (ret)
+		{
+			chunk = mChunks.front();
+			mChunks.pop_front();
+		}
+		UnlockThread();
+		return ret;
+	}
+
+	ThreadPoolImplementation* mPool;
+	::std::deque< Chunk > mChunks;
+
+	//@formatter:off
+	#if BIO_CPP_VERSION >= 11
+		static thread_local Worker* sCurrentWorker;
+	#else
+		static __thread Worker* sCurrentWorker;
+	#endif
+	//@formatter:on
+};
+
+//@formatter:off
+#if BIO_CPP_VERSION >= 11
+	thread_local ThreadPoolImplementation::Worker* ThreadPoolImplementation::Worker::sCurrentWorker = NULL;
+#else
+	__thread ThreadPoolImplementation::Worker* ThreadPoolImplementation::Worker::sCurrentWorker = NULL;
+#endif
+//@formatter:on
+
+ThreadPoolImplementation::ThreadPoolImplementation()
+	:
+	mParking(new Parking()),
+	mIsStarted(false)
+{
+
+}
+
+ThreadPoolImplementation::~ThreadPoolImplementation()
+{
+	Stop();
+	delete mParking;
+}
+
+bool ThreadPoolImplementation::Start(Index numberOfWorkers)
+{
+	LockThread();
+	if (mIsStarted)
+	{
+		UnlockThread();
+		return true;
+	}
+
+	if (!numberOfWorkers)
+	{
+		//@formatter:off
+		#if BIO_CPP_VERSION >= 11
+			Index cores = ::std::thread::hardware_concurrency();
+		#elif defined(BIO_OS_IS_LINUX)
+			Index cores = sysconf(_SC_NPROCESSORS_ONLN);
+		#else
+			Index cores = 1;
+		#endif
+		//@formatter:on
+		numberOfWorkers = cores > 1 ? cores - 1 : 0;
+	}
+
+	#if BIO_THREAD_LOCK_WITH != BIO_THREAD_LOCK_WITH_NOTHING
+	Worker* worker;
+	for (
+		Index wrk = 0;
+		wrk < numberOfWorkers;
+		++wrk
+		)
+	{
+		worker = new Worker(this);
+		mWorkers.push_back(worker);
+	}
+
+	//Start only once all Workers exist, since they look at each other.
+	for (
+		::std::vector< Worker* >::iterator wrk = mWorkers.begin();
+		wrk != mWorkers.end();
+		++wrk
+		)
+	{
+		(*wrk)->Start();
+	}
+	#endif
+
+	mIsStarted = true;
+	UnlockThread();
+	return true;
+}
+
+void ThreadPoolImplementation::Stop()
+{
+	LockThread();
+	//Workers which are Wait()ing would never see their stop request, so wake them first.
+	mParking->Stop();
+	//Workers look at each other, so none may be deleted until all are stopped.
+	for (
+		::std::vector< Worker* >::iterator wrk = mWorkers.begin();
+		wrk != mWorkers.end();
+		++wrk
+		)
+	{
+		(*wrk)->Stop();
+	}
+	for (
+		::std::vector< Worker* >::iterator wrk = mWorkers.begin();
+		wrk != mWorkers.end();
+		++wrk
+		)
+	{
+		delete *wrk;
+	}
+	mWorkers.clear();
+	mParking->Resume();
+	mIsStarted = false;
+	UnlockThread();
+}
+
+bool ThreadPoolImplementation::IsStarted() const
+{
+	LockThread();
+	bool ret = mIsStarted;
+	UnlockThread();
+	return ret;
+}
+
+Index ThreadPoolImplementation::GetNumberOfWorkers() const
+{
+	return mWorkers.size();
+}
+
+void ThreadPoolImplementation::Distribute(
+	ParallelWork* work,
+	const Index count
+)
+{
+	BIO_SANITIZE(work, ,
+		return)
+
+	if (!IsStarted())
+	{
+		Start();
+	}
+
+	if (mWorkers.empty() || count < 2)
+	{
+		for (
+			Index idx = 0;
+			idx < count;
+			++idx
+			)
+		{
+			work->Work(idx);
+		}
+		return;
+	}
+
+	//Make enough Chunks that they can be balanced across all threads, but not so many that queueing them costs more than the work.
+	Index threads = mWorkers.size() + 1;
+	Index chunkSize = count / (threads * 4);
+	if (!chunkSize)
+	{
+		chunkSize = 1;
+	}
+
+	Job job;
+	job.mWork = work;
+	job.mRemaining = (count + chunkSize - 1) / chunkSize;
+	job.mFailed = false;
+
+	//A Worker keeps its own Chunks, so that nested work stays local unless stolen.
+	//Anyone else spreads their Chunks across all Workers.
+	Worker* self = GetCurrentWorker();
+	Chunk chunk;
+	chunk.mJob = &job;
+	Index wrk = 0;
+	for (
+		Index begin = 0;
+		begin < count;
+		begin += chunkSize
+		)
+	{
+		chunk.mBegin = begin;
+		chunk.mEnd = (count - begin) < chunkSize ? count : begin + chunkSize;
+		if (self)
+		{
+			self->Push(chunk);
+		}
+		else
+		{
+			mWorkers[wrk]->Push(chunk);
+			wrk = (wrk + 1) % mWorkers.size();
+		}
+	}
+	mParking->Wake();
+
+	//Help until all of our Chunks are done.
+	//While waiting, we may do Chunks from other Jobs. That's fine: they have to get done anyway.
+	while (true)
+	{
+		job.LockThread();
+		bool isDone = !job.mRemaining;
+		job.UnlockThread();
+		if (isDone)
+		{
+			break;
+		}
+		if (!DoChunk(self))
+		{
+			//@formatter:off
+			#if BIO_CPP_VERSION >= 11
+				::std::this_thread::yield();
+			#elif defined(BIO_OS_IS_LINUX)
+				sched_yield();
+			#endif
+			//@formatter:on
+		}
+	}
+
+	if (job.mFailed)
+	{
+		throw ::std::runtime_error(job.mFailure);
+	}
+}
+
+bool ThreadPoolImplementation::DoChunk(Worker* self)
+{
+	Chunk chunk;
+	if (!FindChunk(
+		self,
+		chunk
+	))
+	{
+		return false;
+	}
+
+	Job* job = chunk.mJob;
+	bool failed = false;
+	::std::string failure;
+	try
+	{
+		for (
+			Index idx = chunk.mBegin;
+			idx < chunk.mEnd;
+			++idx
+			)
+		{
+			job->mWork->Work(idx);
+		}
+	}
+	catch (const ::std::exception& e)
+	{
+		failed = true;
+		failure = e.what();
+	}
+	catch (...)
+	{
+		failed = true;
+		failure = "Unknown exception in ParallelWork";
+	}
+
+	//job may be gone as soon as mRemaining hits 0, so we must not touch it after unlocking.
+	job->LockThread();
+	if (failed && !job->mFailed)
+	{
+		job->mFailed = true;
+		job->mFailure = failure;
+	}
+	--job->mRemaining;
+	job->UnlockThread();
+	return true;
+}
+
+bool ThreadPoolImplementation::FindChunk(
+	Worker* self,
+	Chunk& chunk
+)
+{
+	if (self && self->PopBack(chunk))
+	{
+		return true;
+	}
+
+	for (
+		::std::vector< Worker* >::iterator wrk = mWorkers.begin();
+		wrk != mWorkers.end();
+		++wrk
+		)
+	{
+		if (*wrk != self && (*wrk)->PopFront(chunk))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+ThreadPoolImplementation::Worker* ThreadPoolImplementation::GetCurrentWorker() const
+{
+	Worker* ret = Worker::sCurrentWorker;
+	if (ret && ret->mPool == this)
+	{
+		return ret;
+	}
+	return NULL;
+}
+
+} //bio namespace
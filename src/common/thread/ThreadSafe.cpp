@@ -26,83 +26,66 @@ namespace bio {
 void ThreadSafe::CommonConstructor()
 {
 	//@formatter:off
-	#if BIO_THREAD_ENFORCEMENT_LEVEL > 0
-		#if BIO_CPP_VERSION < 11
-	#ifdef BIO_OS_IS_LINUX
-				pthread_mutexattr_t mutexattr;
-				pthread_mutexattr_init(&mutexattr);
-				pthread_mutexattr_settype(&mutexattr, PTHREAD_MUTEX_NORMAL);
-				pthread_mutex_init(&mLock, &mutexattr);
-			#endif
+	#if BIO_THREAD_LOCK_WITH == BIO_THREAD_LOCK_WITH_STD_ATOMIC_FLAG
+		mFlag.clear();
+	#elif BIO_THREAD_LOCK_WITH == BIO_THREAD_LOCK_WITH_PTHREAD_MUTEX
+		pthread_mutexattr_t mutexattr;
+		pthread_mutexattr_init(&mutexattr);
+		#if BIO_THREAD_ENFORCEMENT_LEVEL > 1
+			//Let pthread tell us when a thread would deadlock itself.
+			pthread_mutexattr_settype(&mutexattr, PTHREAD_MUTEX_ERRORCHECK);
 		#else
+			pthread_mutexattr_settype(&mutexattr, PTHREAD_MUTEX_NORMAL);
 		#endif
+		pthread_mutex_init(&mLock, &mutexattr);
+		pthread_mutexattr_destroy(&mutexattr);
+	#elif BIO_THREAD_LOCK_WITH == BIO_THREAD_LOCK_WITH_PTHREAD_SPINLOCK
+		pthread_spin_init(&mLock, PTHREAD_PROCESS_PRIVATE);
+	#elif BIO_THREAD_LOCK_WITH == BIO_THREAD_LOCK_WITH_PTHREAD_RWLOCK
+		pthread_rwlock_init(&mLock, NULL);
 	#endif
-	//@formatter:on
 
-	#if BIO_THREAD_ENFORCEMENT_LEVEL > 1
-	mIsLocked = false;
+	#if BIO_THREAD_ENFORCEMENT_LEVEL > 1 && BIO_CPP_VERSION >= 11
+		mOwner.store(::std::thread::id(), ::std::memory_order_relaxed);
 	#endif
+	//@formatter:on
 }
 
-ThreadSafe::ThreadSafe()
+void ThreadSafe::CommonDestructor()
+{
 	//@formatter:off
-	#if BIO_THREAD_ENFORCEMENT_LEVEL > 0
-		#if BIO_CPP_VERSION < 11
-		#else
-			:
-			mMutex(),
-			mLock(mMutex, ::std::defer_lock)
-		#endif
+	#if BIO_THREAD_LOCK_WITH == BIO_THREAD_LOCK_WITH_PTHREAD_MUTEX
+		pthread_mutex_destroy(&mLock);
+	#elif BIO_THREAD_LOCK_WITH == BIO_THREAD_LOCK_WITH_PTHREAD_SPINLOCK
+		pthread_spin_destroy(&mLock);
+	#elif BIO_THREAD_LOCK_WITH == BIO_THREAD_LOCK_WITH_PTHREAD_RWLOCK
+		pthread_rwlock_destroy(&mLock);
 	#endif
 	//@formatter:on
+}
+
+ThreadSafe::ThreadSafe()
 {
 	CommonConstructor();
 }
 
 #if BIO_CPP_VERSION >= 11
 ThreadSafe::ThreadSafe(ThreadSafe&& toMove)
-	//@formatter:off
-	#if BIO_THREAD_ENFORCEMENT_LEVEL > 0
-		#if BIO_CPP_VERSION < 11
-		#else
-			:
-			mMutex(),
-			mLock(mMutex, ::std::defer_lock)
-		#endif
-	#endif
-	//@formatter:on
 {
+	//locks are never moved.
 	CommonConstructor();
 }
 #endif
 
 ThreadSafe::ThreadSafe(const ThreadSafe& toCopy)
-//@formatter:off
-#if BIO_THREAD_ENFORCEMENT_LEVEL > 0
-	#if BIO_CPP_VERSION < 11
-	#else
-	:
-	mMutex(),
-	mLock(mMutex, ::std::defer_lock)
-#endif
-#endif
-//@formatter:on
 {
+	//locks are never copied.
 	CommonConstructor();
 }
 
 ThreadSafe::~ThreadSafe()
 {
-	//@formatter:off
-	#if BIO_THREAD_ENFORCEMENT_LEVEL > 0
-		#if BIO_CPP_VERSION < 11
-			#ifdef BIO_OS_IS_LINUX
-				pthread_mutex_destroy(&mLock);
-			#endif
-		#else
-		#endif
-	#endif
-	//@formatter:on
+	CommonDestructor();
 }
 
 #if BIO_CPP_VERSION >= 11
@@ -121,40 +104,90 @@ ThreadSafe& ThreadSafe::operator=(const ThreadSafe& toCopy)
 
 void ThreadSafe::LockThread() const
 {
-	#if BIO_THREAD_ENFORCEMENT_LEVEL > 1
-	BIO_SANITIZE(!mIsLocked,,return)
-	mIsLocked = true;
+	//@formatter:off
+	#if BIO_THREAD_ENFORCEMENT_LEVEL > 1 && BIO_CPP_VERSION >= 11
+		BIO_SANITIZE(mOwner.load(::std::memory_order_relaxed) != ::std::this_thread::get_id(), , return)
 	#endif
 
-	//@formatter:off
-	#if BIO_THREAD_ENFORCEMENT_LEVEL > 0
-		#if BIO_CPP_VERSION < 11
-			#ifdef BIO_OS_IS_LINUX
-				pthread_mutex_lock(&mLock);
-			#endif
+	#if BIO_THREAD_LOCK_WITH == BIO_THREAD_LOCK_WITH_STD_MUTEX || BIO_THREAD_LOCK_WITH == BIO_THREAD_LOCK_WITH_STD_SHARED_MUTEX
+		mMutex.lock();
+	#elif BIO_THREAD_LOCK_WITH == BIO_THREAD_LOCK_WITH_STD_ATOMIC_FLAG
+		while (mFlag.test_and_set(::std::memory_order_acquire))
+		{
+			//spin
+		}
+	#elif BIO_THREAD_LOCK_WITH == BIO_THREAD_LOCK_WITH_PTHREAD_MUTEX
+		#if BIO_THREAD_ENFORCEMENT_LEVEL > 1
+			BIO_SANITIZE(!pthread_mutex_lock(&mLock), , return)
 		#else
-			mLock.lock();
+			pthread_mutex_lock(&mLock);
 		#endif
+	#elif BIO_THREAD_LOCK_WITH == BIO_THREAD_LOCK_WITH_PTHREAD_SPINLOCK
+		pthread_spin_lock(&mLock);
+	#elif BIO_THREAD_LOCK_WITH == BIO_THREAD_LOCK_WITH_PTHREAD_RWLOCK
+		pthread_rwlock_wrlock(&mLock);
+	#endif
+
+	#if BIO_THREAD_ENFORCEMENT_LEVEL > 1 && BIO_CPP_VERSION >= 11
+		mOwner.store(::std::this_thread::get_id(), ::std::memory_order_relaxed);
 	#endif
 	//@formatter:on
 }
 
 void ThreadSafe::UnlockThread() const
 {
-	#if BIO_THREAD_ENFORCEMENT_LEVEL > 1
-	BIO_SANITIZE(mIsLocked,,return)
-	mIsLocked = false;
+	//@formatter:off
+	#if BIO_THREAD_ENFORCEMENT_LEVEL > 1 && BIO_CPP_VERSION >= 11
+		BIO_SANITIZE(mOwner.load(::std::memory_order_relaxed) == ::std::this_thread::get_id(), , return)
+		mOwner.store(::std::thread::id(), ::std::memory_order_relaxed);
 	#endif
 
-	//@formatter:off
-	#if BIO_THREAD_ENFORCEMENT_LEVEL > 0
-		#if BIO_CPP_VERSION < 11
-			#ifdef BIO_OS_IS_LINUX
-				pthread_mutex_unlock(&mLock);
-			#endif
+	#if BIO_THREAD_LOCK_WITH == BIO_THREAD_LOCK_WITH_STD_MUTEX || BIO_THREAD_LOCK_WITH == BIO_THREAD_LOCK_WITH_STD_SHARED_MUTEX
+		mMutex.unlock();
+	#elif BIO_THREAD_LOCK_WITH == BIO_THREAD_LOCK_WITH_STD_ATOMIC_FLAG
+		mFlag.clear(::std::memory_order_release);
+	#elif BIO_THREAD_LOCK_WITH == BIO_THREAD_LOCK_WITH_PTHREAD_MUTEX
+		#if BIO_THREAD_ENFORCEMENT_LEVEL > 1
+			BIO_SANITIZE(!pthread_mutex_unlock(&mLock), , return)
 		#else
-			mLock.unlock();
+			pthread_mutex_unlock(&mLock);
+		#endif
+	#elif BIO_THREAD_LOCK_WITH == BIO_THREAD_LOCK_WITH_PTHREAD_SPINLOCK
+		pthread_spin_unlock(&mLock);
+	#elif BIO_THREAD_LOCK_WITH == BIO_THREAD_LOCK_WITH_PTHREAD_RWLOCK
+		pthread_rwlock_unlock(&mLock);
+	#endif
+	//@formatter:on
+}
+
+void ThreadSafe::LockThreadShared() const
+{
+	//@formatter:off
+	#if BIO_THREAD_LOCK_WITH == BIO_THREAD_LOCK_WITH_STD_SHARED_MUTEX
+		#if BIO_THREAD_ENFORCEMENT_LEVEL > 1
+			BIO_SANITIZE(mOwner.load(::std::memory_order_relaxed) != ::std::this_thread::get_id(), , return)
+		#endif
+		mMutex.lock_shared();
+	#elif BIO_THREAD_LOCK_WITH == BIO_THREAD_LOCK_WITH_PTHREAD_RWLOCK
+		#if BIO_THREAD_ENFORCEMENT_LEVEL > 1 && BIO_CPP_VERSION >= 11
+			BIO_SANITIZE(mOwner.load(::std::memory_order_relaxed) != ::std::this_thread::get_id(), , return)
 		#endif
+		pthread_rwlock_rdlock(&mLock);
+	#else
+		LockThread();
+	#endif
+	//@formatter:on
+}
+
+void ThreadSafe::UnlockThreadShared() const
+{
+	//@formatter:off
+	#if BIO_THREAD_LOCK_WITH == BIO_THREAD_LOCK_WITH_STD_SHARED_MUTEX
+		mMutex.unlock_shared();
+	#elif BIO_THREAD_LOCK_WITH == BIO_THREAD_LOCK_WITH_PTHREAD_RWLOCK
+		pthread_rwlock_unlock(&mLock);
+	#else
+		UnlockThread();
 	#endif
 	//@formatter:on
 }
@@ -86,9 +86,9 @@ void Threaded::RequestStop()
 	bool again = true;
 	while (again)
 	{
-		bool again = threaded->Work();
+		again = threaded->Work();
 		threaded->LockThread();
-		again = again && threaded->mStopRequested;
+		again = again && !threaded->mStopRequested;
 		threaded->UnlockThread();
 	}
 
@@ -117,18 +117,22 @@ bool Threaded::Start()
 	bool isStopped = !mCreated && !mRunning;
 	UnlockThread();
 	//@formatter:off
-	BIO_SANITIZE(!isStopped, ,return true)
+	BIO_SANITIZE(isStopped, ,return true)
 	//@formatter:on
 
+	LockThread();
+	mStopRequested = false;
+	UnlockThread();
+
 	//@formatter:off
 	#if BIO_CPP_VERSION < 11
-		BIO_SANITIZE(mRunning,,return false)
+		BIO_SANITIZE(!mRunning,,return false)
 		#ifdef BIO_OS_IS_LINUX
 			int result = pthread_create(&mThread, NULL, Worker, this);
 		#endif
 		mCreated = result == 0;
 	#else
-		BIO_SANITIZE(mThread,,return false)
+		BIO_SANITIZE(!mThread,,return false)
 		mThread = new ::std::thread(&Threaded::Worker, this);
 		mCreated = true;
 	#endif
@@ -142,16 +146,15 @@ bool Threaded::Stop()
 	bool isStopped = !mCreated && !mRunning;
 	UnlockThread();
 
-	BIO_SANITIZE(isStopped, ,
+	BIO_SANITIZE(!isStopped, ,
 		return true)
 	//@formatter:off
 	#if BIO_CPP_VERSION < 11
-		mStopRequested = true;
+		RequestStop();
 		#ifdef BIO_OS_IS_LINUX
-            void** threadReturn; 
-			int result = pthread_join(mThread, threadReturn);
+			void* threadReturn;
+			int result = pthread_join(mThread, &threadReturn);
 		#endif
-		RequestStop();
 		mCreated = false;
 		return result == 0;
 	#else
@@ -38,7 +38,7 @@ Engine::Engine()
 {
 	//Set all filters to only log if level is >= Info
 	mLevelFilter.assign(
-		SafelyAccess<FilterPerspective>()->GetNumUsedIds(),
+		SafelyRead<FilterPerspective>()->GetNumUsedIds(),
 		log_level::Info());
 }
 
@@ -76,7 +76,7 @@ void Engine::Log(
 	mLogMessage.clear();
 	mLogMessage.str(""); //TODO: is seekp good enough? what is faster?
 
-	mLogMessage << physical::GetCurrentTimestamp() << " " << SafelyAccess<FilterPerspective>()->GetNameFromId(filter) << " " << SafelyAccess<LogLevelPerspective>()->GetNameFromId(level) << ": " << str << "\n";
+	mLogMessage << physical::GetCurrentTimestamp() << " " << SafelyRead<FilterPerspective>()->GetNameFromId(filter) << " " << SafelyRead<LogLevelPerspective>()->GetNameFromId(level) << ": " << str << "\n";
 	Output(mLogMessage.str());
 }
 
@@ -127,7 +127,7 @@ bool Engine::SetFilter(
 	if (filter == filter::All())
 	{
 		mLevelFilter.assign(
-			SafelyAccess<FilterPerspective>()->GetNumUsedIds(),
+			SafelyRead<FilterPerspective>()->GetNumUsedIds(),
 			level);
 	}
 	else
@@ -36,9 +36,34 @@ Molecule::Molecule(const Molecule& toCopy)
 		toCopy.GetPerspective(),
 		toCopy.GetFilter()),
 	physical::Perspective< Id >(toCopy),
-	chemical::LinearMotif< Surface* >(toCopy)
+	chemical::LinearMotif< Surface* >(toCopy),
+	mCopyOnWrite(toCopy.mCopyOnWrite)
 {
 	chemical::LinearMotif< Surface* >::mPerspective = this;
+
+	if (mCopyOnWrite)
+	{
+		//Rather than sharing the Surfaces of toCopy, give *this its own, which will share their values with toCopy until they are written to.
+		::std::vector< Surface* > surfaces;
+		toCopy.GatherContentsImplementation(surfaces);
+		chemical::LinearMotif< Surface* >::ClearImplementation();
+		Surface* surface;
+		for (
+			::std::vector< Surface* >::const_iterator srf = surfaces.begin();
+			srf != surfaces.end();
+			++srf
+			)
+		{
+			surface = CloneAndCast< Surface* >(*srf);
+			surface->SetEnvironment(this);
+			Add< Surface* >(surface);
+		}
+	}
+}
+
+void Molecule::CommonConstructor()
+{
+	mCopyOnWrite = false;
 }
 
 Molecule::~Molecule()
@@ -82,7 +107,10 @@ bool Molecule::DuplicateFrom(
 		toTransfer = RESULT,
 		return false);
 
-	Add< Surface* >(CloneAndCast< Surface* >(toTransfer))->SetEnvironment(this);
+	//The environment determines the Id of the Surface, so it must be set before we index the Surface by Adding it.
+	Surface* clone = CloneAndCast< Surface* >(toTransfer);
+	clone->SetEnvironment(this);
+	Add< Surface* >(clone);
 	return true;
 }
 
@@ -103,8 +131,10 @@ bool Molecule::TransferFrom(
 		toTransfer = RESULT,
 		return false);
 
-	Add< Surface* >(toTransfer)->SetEnvironment(this);
+	//Changing the environment changes the Id of the Surface, so it must leave source before and join *this after; see Line.
 	source->Remove< Surface* >(toTransfer);
+	toTransfer->SetEnvironment(this);
+	Add< Surface* >(toTransfer);
 	return true;
 }
 
@@ -132,7 +162,8 @@ Molecule* Molecule::operator<<(Surface* source)
 {
 	BIO_SANITIZE(source, ,
 		return this);
-	Add< Surface* >(source)->SetEnvironment(this);
+	source->SetEnvironment(this);
+	Add< Surface* >(source);
 	return this;
 }
 
@@ -173,5 +204,23 @@ Code Molecule::Reify(physical::Symmetry* symmetry)
 	return code::NotImplemented();
 }
 
+void Molecule::SetCopyOnWrite(bool copyOnWrite)
+{
+	mCopyOnWrite = copyOnWrite;
+	for (
+		SmartIterator srf = chemical::LinearMotif< Surface* >::mContents;
+		!srf.IsBeforeBeginning();
+		--srf
+		)
+	{
+		ChemicalCast< Surface* >(srf.As< physical::Linear >().operator physical::Identifiable< Id >*())->SetCopyOnWrite(copyOnWrite);
+	}
+}
+
+bool Molecule::IsCopyOnWrite() const
+{
+	return mCopyOnWrite;
+}
+
 } //molecular namespace
 } //bio namespace
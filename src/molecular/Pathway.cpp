@@ -24,6 +24,7 @@
 //
 
 #include "bio/molecular/Pathway.h"
+#include "bio/chemical/common/Codes.h"
 
 namespace bio {
 namespace molecular {
@@ -33,30 +34,85 @@ Pathway::~Pathway()
 
 }
 
-chemical::Products Pathway::Process(chemical::Reactants* reactants)
+chemical::Products Pathway::Process(chemical::Reactants* reactants) const
+{
+	::std::vector< chemical::Reaction* > reactions;
+	chemical::LinearMotif< chemical::Reaction* >::GatherContentsImplementation(reactions);
+	return ProcessReactions(
+		reactants,
+		reactions);
+}
+
+void Pathway::ProcessEach(
+	chemical::Reactants* const* reactants,
+	const Index count,
+	chemical::Products* products
+) const
+{
+	BIO_SANITIZE(reactants && products, , return)
+
+	//Find our Reactions once, rather than once per set.
+	::std::vector< chemical::Reaction* > reactions;
+	chemical::LinearMotif< chemical::Reaction* >::GatherContentsImplementation(reactions);
+
+	if (count > 1)
+	{
+		Batch batch(
+			this,
+			reactions,
+			reactants,
+			products
+		);
+		ThreadPool::Instance().Distribute(
+			&batch,
+			count
+		);
+		return;
+	}
+	for (
+		Index index = 0;
+		index < count;
+		++index
+		)
+	{
+		if (!reactants[index])
+		{
+			products[index] = chemical::Products(code::FailedReaction());
+			continue;
+		}
+		products[index] = ProcessReactions(
+			reactants[index],
+			reactions);
+	}
+}
+
+chemical::Products Pathway::ProcessReactions(
+	chemical::Reactants* reactants,
+	const ::std::vector< chemical::Reaction* >& reactions
+) const
 {
 	BIO_SANITIZE(reactants, ,
 		return code::BadArgument1())
 
 	chemical::Products products(reactants);
-	Reaction* reaction;
+	chemical::Reactants* nextReactants = mReactantsPool.Borrow();
 	for (
-		SmartIterator rct = GetAll< Reaction* >()->Begin();
-		!rct.IsAfterEnd();
-		++rct
+		::std::vector< chemical::Reaction* >::const_iterator reaction = reactions.begin();
+		reaction != reactions.end();
+		++reaction
 		)
 	{
 		if (products == code::Success() && products != code::NoErrorNoSuccess())
 		{
-			chemical::Reactants nextReactants(products);
-			reaction = rct;
-			products = (*reaction)(&nextReactants);
+			nextReactants->Reset(products.GetSubstances());
+			products = (**reaction)(nextReactants);
 		}
 		else
 		{
 			break;
 		}
 	}
+	mReactantsPool.Return(nextReactants);
 	return products;
 }
 
@@ -64,7 +120,36 @@ bool Pathway::ReactantsMeetRequirements(const chemical::Reactants* toCheck) cons
 {
 	BIO_SANITIZE(GetCount< chemical::Reaction* >(), ,
 		return false)
-	return GetAll< chemical::Reaction* >()->Begin().As< chemical::Reaction* >()->ReactantsMeetRequirements(toCheck);
+	//Our contents are stored in Linear wrappers, which must be cast back to Reactions.
+	const chemical::Reaction* first = ChemicalCast< chemical::Reaction* >(GetAll< chemical::Reaction* >()->Begin().As< physical::Linear >().operator physical::Identifiable< Id >*());
+	return first->ReactantsMeetRequirements(toCheck);
+}
+
+Pathway::Batch::Batch(
+	const Pathway* pathway,
+	const ::std::vector< chemical::Reaction* >& reactions,
+	chemical::Reactants* const* reactants,
+	chemical::Products* products
+)
+	:
+	mPathway(pathway),
+	mReactions(reactions),
+	mReactants(reactants),
+	mProducts(products)
+{
+
+}
+
+void Pathway::Batch::Work(const Index index)
+{
+	if (!mReactants[index])
+	{
+		mProducts[index] = chemical::Products(code::FailedReaction());
+		return;
+	}
+	mProducts[index] = mPathway->ProcessReactions(
+		mReactants[index],
+		mReactions);
 }
 
 } //molecular namespace
@@ -39,7 +39,8 @@ Surface::Surface(
 		filter::Molecular(),
 		symmetry_type::Variable()),
 	EnvironmentDependent< Molecule >(environment),
-	mBoundPosition(InvalidIndex())
+	mBoundPosition(InvalidIndex()),
+	mCopyOnWrite(environment && environment->IsCopyOnWrite())
 {
 
 }
@@ -53,9 +54,12 @@ Surface::Surface(const Surface& toCopy)
 		toCopy.GetFilter(),
 		symmetry_type::Variable()),
 	EnvironmentDependent< Molecule >(toCopy),
-	mBoundPosition(toCopy.mBoundPosition)
+	mBoundPosition(toCopy.mBoundPosition),
+	mCopyOnWrite(toCopy.mCopyOnWrite)
 {
 	chemical::Bond* bond;
+	Share* share;
+	SharedBond shared;
 	for (
 		SmartIterator bnd = toCopy.mBonds.End();
 		!bnd.IsBeforeBeginning();
@@ -65,6 +69,20 @@ Surface::Surface(const Surface& toCopy)
 		bond = bnd;
 		if (bond->GetType() == bond_type::Manage())
 		{
+			share = toCopy.GetShareAt(bnd.GetIndex());
+			if (share)
+			{
+				//Copy on write: just point to the same Wave and count ourselves as another owner.
+				share->Acquire();
+				shared.mPosition = FormBondImplementation(
+					bond->GetBonded(),
+					bond->GetId(),
+					bond->GetType());
+				shared.mShare = share;
+				mSharedBonds.push_back(shared);
+				continue;
+			}
+
 			//Calling FormBondImplementation directly saves us some work and should be safer than trying to do auto-template type determination from Clone().
 			FormBondImplementation(
 				bond->GetBonded()->Clone(),
@@ -72,11 +90,17 @@ Surface::Surface(const Surface& toCopy)
 				bond->GetType());
 		}
 	}
+
+	if (mCopyOnWrite)
+	{
+		ShareManagedBonds();
+	}
 }
 
 Surface::~Surface()
 {
 	chemical::Bond* bond;
+	Share* share;
 	for (
 		SmartIterator bnd = mBonds.End();
 		!bnd.IsBeforeBeginning();
@@ -86,6 +110,15 @@ Surface::~Surface()
 		bond = bnd;
 		if (bond->GetType() == bond_type::Manage())
 		{
+			share = GetShareAt(bnd.GetIndex());
+			if (share && share->Abandon())
+			{
+				//Someone else still needs the Wave.
+				bond->Break();
+				continue;
+			}
+			delete share;
+
 			//bypass BreakBondImplementation and just do it.
 			delete bond->GetBonded();
 			bond->Break();
@@ -93,11 +126,192 @@ Surface::~Surface()
 	}
 }
 
+Surface::Share::Share()
+	:
+	mSharers(1)
+{
+
+}
+
+void Surface::Share::Acquire()
+{
+	LockThread();
+	++mSharers;
+	UnlockThread();
+}
+
+Index Surface::Share::Abandon()
+{
+	LockThread();
+	Index ret = --mSharers;
+	UnlockThread();
+	return ret;
+}
+
+physical::Wave* Surface::Share::Fork(const physical::Wave* shared)
+{
+	physical::Wave* ret = NULL;
+	LockThread();
+	if (mSharers > 1)
+	{
+		ret = shared->Clone();
+		--mSharers;
+	}
+	UnlockThread();
+	return ret;
+}
+
+Index Surface::Share::GetNumberOfSharers() const
+{
+	LockThread();
+	Index ret = mSharers;
+	UnlockThread();
+	return ret;
+}
+
+void Surface::SetCopyOnWrite(bool copyOnWrite)
+{
+	mCopyOnWrite = copyOnWrite;
+	if (mCopyOnWrite)
+	{
+		ShareManagedBonds();
+		return;
+	}
+
+	Detach();
+	for (
+		::std::vector< SharedBond >::iterator shared = mSharedBonds.begin();
+		shared != mSharedBonds.end();
+		++shared
+		)
+	{
+		delete shared->mShare;
+	}
+	mSharedBonds.clear();
+}
+
+bool Surface::IsCopyOnWrite() const
+{
+	return mCopyOnWrite;
+}
+
+bool Surface::IsShared() const
+{
+	for (
+		::std::vector< SharedBond >::const_iterator shared = mSharedBonds.begin();
+		shared != mSharedBonds.end();
+		++shared
+		)
+	{
+		if (shared->mShare->GetNumberOfSharers() > 1)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void Surface::Detach()
+{
+	chemical::Bond* bond;
+	physical::Wave* clone;
+	chemical::AtomicNumber id;
+	BondType type;
+	for (
+		::std::vector< SharedBond >::iterator shared = mSharedBonds.begin();
+		shared != mSharedBonds.end();
+		++shared
+		)
+	{
+		bond = mBonds.OptimizedAccess(shared->mPosition);
+
+		clone = shared->mShare->Fork(bond->GetBonded());
+		if (!clone)
+		{
+			continue;
+		}
+
+		id = bond->GetId();
+		type = bond->GetType();
+		bond->Break();
+		bond->Form(
+			id,
+			clone,
+			type);
+		shared->mShare = new Share();
+	}
+}
+
+void Surface::ShareManagedBonds()
+{
+	chemical::Bond* bond;
+	SharedBond shared;
+	for (
+		SmartIterator bnd = mBonds.End();
+		!bnd.IsBeforeBeginning();
+		--bnd
+		)
+	{
+		bond = bnd;
+		if (bond->GetType() == bond_type::Manage() && !GetShareAt(bnd.GetIndex()))
+		{
+			shared.mPosition = bnd.GetIndex();
+			shared.mShare = new Share();
+			mSharedBonds.push_back(shared);
+		}
+	}
+}
+
+Surface::Share* Surface::GetShareAt(chemical::Valence position) const
+{
+	for (
+		::std::vector< SharedBond >::const_iterator shared = mSharedBonds.begin();
+		shared != mSharedBonds.end();
+		++shared
+		)
+	{
+		if (shared->mPosition == position)
+		{
+			return shared->mShare;
+		}
+	}
+	return NULL;
+}
+
+void Surface::ForgetShareAt(chemical::Valence position)
+{
+	for (
+		::std::vector< SharedBond >::iterator shared = mSharedBonds.begin();
+		shared != mSharedBonds.end();
+		++shared
+		)
+	{
+		if (shared->mPosition == position)
+		{
+			if (!shared->mShare->Abandon())
+			{
+				delete shared->mShare;
+			}
+			mSharedBonds.erase(shared);
+			return;
+		}
+	}
+}
+
 void Surface::SetEnvironment(Molecule* environment)
 {
 	mEnvironment = environment;
-	SetId(0); //0 should always be invalid.
+	if (!environment)
+	{
+		SetId(0); //0 should always be invalid.
+		Identifiable< Id >::SetPerspective(environment);
+		return;
+	}
+
+	//Keep our Name and look up what Id it has in the new environment.
+	Name name = GetName();
 	Identifiable< Id >::SetPerspective(environment);
+	SetName(name);
 }
 
 void Surface::SetPerspective(Molecule* perspective)
@@ -124,6 +338,11 @@ physical::Wave* Surface::Release(
 {
 	physical::Wave* ret = NULL;
 	chemical::Bond* bond;
+	if (bondType == bond_type::Manage())
+	{
+		//The caller will own what we Release, so it must not be shared.
+		Detach();
+	}
 	for (
 		SmartIterator bnd = mBonds.End();
 		!bnd.IsBeforeBeginning();
@@ -136,6 +355,7 @@ physical::Wave* Surface::Release(
 			ret = ChemicalCast< physical::Wave* >(bond->GetBonded());
 			BIO_SANITIZE_AT_SAFETY_LEVEL_1(!ret || ret != toRelease,
 				continue,);
+			ForgetShareAt(bnd.GetIndex());
 			bond->Break();
 			break;
 		}
@@ -154,6 +374,11 @@ chemical::Substance* Surface::Release(
 {
 	chemical::Substance* ret = NULL;
 	chemical::Bond* bond;
+	if (bondType == bond_type::Manage())
+	{
+		//The caller will own what we Release, so it must not be shared.
+		Detach();
+	}
 	for (
 		SmartIterator bnd = mBonds.End();
 		!bnd.IsBeforeBeginning();
@@ -170,6 +395,7 @@ chemical::Substance* Surface::Release(
 				continue);
 			BIO_SANITIZE_AT_SAFETY_LEVEL_1(perspective && ret->GetPerspective() != perspective,
 				continue,);
+			ForgetShareAt(bnd.GetIndex());
 			bond->Break();
 			break;
 		}
@@ -188,6 +414,11 @@ chemical::Substance* Surface::Release(
 {
 	chemical::Substance* ret = NULL;
 	chemical::Bond* bond;
+	if (bondType == bond_type::Manage())
+	{
+		//The caller will own what we Release, so it must not be shared.
+		Detach();
+	}
 	for (
 		SmartIterator bnd = mBonds.End();
 		!bnd.IsBeforeBeginning();
@@ -204,6 +435,7 @@ chemical::Substance* Surface::Release(
 				continue);
 			BIO_SANITIZE_AT_SAFETY_LEVEL_1(perspective && ret->GetPerspective() != perspective,
 				continue,);
+			ForgetShareAt(bnd.GetIndex());
 			bond->Break();
 			break;
 		}
@@ -218,6 +450,11 @@ physical::Waves Surface::Release(BondType bondType)
 {
 	physical::Waves ret;
 	chemical::Bond* bond;
+	if (bondType == bond_type::Manage())
+	{
+		//The caller will own what we Release, so it must not be shared.
+		Detach();
+	}
 	for (
 		SmartIterator bnd = mBonds.End();
 		!bnd.IsBeforeBeginning();
@@ -228,6 +465,7 @@ physical::Waves Surface::Release(BondType bondType)
 		if (bond->GetType() == bondType)
 		{
 			ret.Add(ChemicalCast< physical::Wave* >(bond->GetBonded()));
+			ForgetShareAt(bnd.GetIndex());
 			bond->Break();
 		}
 	}
@@ -27,6 +27,7 @@ namespace molecular {
 
 Vesicle::Vesicle(const Vesicle& toCopy)
 	:
+	Molecule(toCopy),
 	molecular::Class< Vesicle >(
 		this,
 		toCopy.GetId(),
@@ -20,6 +20,8 @@
  */
 
 #include "bio/organic/Habitat.h"
+#include "bio/chemical/PeriodicTable.h"
+#include "bio/physical/common/Types.h"
 
 namespace bio {
 namespace organic {
@@ -49,6 +51,11 @@ Code Habitat::AdaptInhabitants()
 			ret = code::UnknownError();
 		}
 	}
+
+	//Our inhabitants have now registered (nearly) every type they will use, so lookups can stop locking.
+	//The Snapshots replaced by any later writes are freed by the Perspectives themselves, once no lookup is using them.
+	SafelyAccess< chemical::PeriodicTable >()->SetReadMostly(true);
+	SafelyAccess< physical::SymmetryPerspective >()->SetReadMostly(true);
 	return ret;
 }
 
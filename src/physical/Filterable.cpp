@@ -32,7 +32,7 @@ Filterable::Filterable()
 	:
 	Class(
 		this,
-		new Symmetry(
+		Symmetry::FromPrototype< Filterable >(
 			"mFilter",
 			symmetry_type::DefineVariable())),
 	mFilter(filter::Default())
@@ -43,7 +43,7 @@ Filterable::Filterable(Filter filter)
 	:
 	Class(
 		this,
-		new Symmetry(
+		Symmetry::FromPrototype< Filterable >(
 			"mFilter",
 			symmetry_type::DefineVariable())),
 	mFilter(filter)
@@ -45,7 +45,7 @@ Periodic::Periodic(MicroSeconds interval)
 	:
 	Class(
 		this,
-		new Symmetry(
+		Symmetry::FromPrototype< Periodic >(
 			"mInterval",
 			symmetry_type::DefineVariable())),
 	mInterval(
@@ -44,9 +44,10 @@ Symmetry::Symmetry(
 		type,
 		&SymmetryTypePerspective::Instance())
 {
+	//Initialize only recognizes a Perspective< Id >*, not the SymmetryPerspective* it derives from.
 	Identifiable< Id >::Initialize(
 		name,
-		&SymmetryPerspective::Instance());
+		static_cast< physical::Perspective< Id >* >(&SymmetryPerspective::Instance()));
 }
 
 Symmetry::Symmetry(
@@ -55,13 +56,12 @@ Symmetry::Symmetry(
 )
 	:
 	Class< Symmetry >(this),
-	mType(
-		type,
-		&SymmetryTypePerspective::Instance())
+	mType(&SymmetryTypePerspective::Instance())
 {
 	Identifiable< Id >::Initialize(
 		name,
-		&SymmetryPerspective::Instance());
+		static_cast< physical::Perspective< Id >* >(&SymmetryPerspective::Instance()));
+	mType.SetId(type);
 }
 
 Symmetry::Symmetry(
@@ -76,7 +76,7 @@ Symmetry::Symmetry(
 {
 	Identifiable< Id >::Initialize(
 		id,
-		&SymmetryPerspective::Instance());
+		static_cast< physical::Perspective< Id >* >(&SymmetryPerspective::Instance()));
 }
 
 Symmetry::Symmetry(
@@ -85,13 +85,34 @@ Symmetry::Symmetry(
 )
 	:
 	Class< Symmetry >(this),
-	mType(
-		type,
-		&SymmetryTypePerspective::Instance())
+	mType(&SymmetryTypePerspective::Instance())
 {
 	Identifiable< Id >::Initialize(
 		id,
-		&SymmetryPerspective::Instance());
+		static_cast< physical::Perspective< Id >* >(&SymmetryPerspective::Instance()));
+	mType.SetId(type);
+}
+
+Symmetry::Symmetry(const Symmetry& toCopy)
+	:
+	Identifiable< Id >(toCopy),
+	Class< Symmetry >(this),
+	mValue(toCopy.mValue),
+	mType(toCopy.mType)
+{
+
+}
+
+Symmetry& Symmetry::operator=(const Symmetry& toCopy)
+{
+	if (this == &toCopy)
+	{
+		return *this;
+	}
+	Identifiable< Id >::operator=(toCopy);
+	mValue = toCopy.mValue;
+	mType = toCopy.mType;
+	return *this;
 }
 
 Symmetry::~Symmetry()
@@ -148,35 +148,8 @@ Properties Wave::GetProperties() const
 	const Properties& properties
 )
 {
-	class TempWave :
-		public Wave
-	{
-	public:
-		TempWave(Properties p)
-			:
-			mProperties(p)
-		{
-		}
-
-		~TempWave()
-		{
-		}
-
-		virtual Properties GetProperties() const
-		{
-			return mProperties;
-		}
-
-		Properties mProperties;
-	};
-
-	ConstWaves waves;
-	waves.Add(wave);
-	TempWave twave(properties);
-	ByteStream overt;
-	overt.Set< Wave* >(&twave);
-	waves.Add(overt);
-	return GetResonanceBetween(waves);
+	Spectrum overlap = ResonanceTable::Instance().GetSpectrumOf(wave) & Spectrum(properties);
+	return overlap.AsProperties();
 }
 
 /*static*/ Properties Wave::GetResonanceBetween(
@@ -184,49 +157,35 @@ Properties Wave::GetProperties() const
 	const Wave* wave2
 )
 {
-	ConstWaves waves;
-	waves.Add(
-		wave1
-	);
-	waves.Add(
-		wave2
-	);
-	return GetResonanceBetween(
-		waves
-	);
+	Spectrum overlap = ResonanceTable::Instance().GetSpectrumOf(wave1) & ResonanceTable::Instance().GetSpectrumOf(wave2);
+	return overlap.AsProperties();
 }
 
 /*static*/ Properties Wave::GetResonanceBetween(
 	ConstWaves waves
 )
 {
-	Properties overlap;
-	BIO_SANITIZE(waves.Size() && waves[0], ,
-		return overlap);
-	overlap = waves[0].As< Wave* >()->GetProperties();
-	BIO_SANITIZE_AT_SAFETY_LEVEL_1(waves.Size() > 1, ,
-		return overlap);
-
+	BIO_SANITIZE(waves.Size(), ,
+		return Properties());
+	SmartIterator wav = waves.Begin();
+	Spectrum overlap = ResonanceTable::Instance().GetSpectrumOf(wav.As< const Wave* >());
 	for (
-		SmartIterator wav = waves.Begin()++;
-		!wav.IsAfterEnd();
+		++wav;
+		!wav.IsAfterEnd() && !overlap.IsEmpty();
 		++wav
 		)
 	{
-		Properties wavProperties = wav.As< Wave* >()->GetProperties();
-		for (
-			SmartIterator prp = overlap.Begin();
-			!prp.IsAfterEnd();
-			++prp
-			)
-		{
-			if (!wavProperties.Has(prp.As< Property >()))
-			{
-				overlap.Erase(prp);
-			}
-		}
+		overlap = overlap & ResonanceTable::Instance().GetSpectrumOf(wav.As< const Wave* >());
 	}
-	return overlap;
+	return overlap.AsProperties();
+}
+
+/*static*/ bool Wave::Resonates(
+	const Wave* wave1,
+	const Wave* wave2
+)
+{
+	return ResonanceTable::Instance().GetSpectrumOf(wave1).Overlaps(ResonanceTable::Instance().GetSpectrumOf(wave2));
 }
 
 } //physical namespace
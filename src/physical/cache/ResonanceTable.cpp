@@ -0,0 +1,318 @@
+/*
+ * This file is a part of the Biology project by eons LLC.
+ * Biology (aka Develop Biology) is a framework for approaching software
+ * development from a natural sciences perspective.
+ *
+ * Copyright (C) 2022 Séon O'Shannon & eons LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "bio/physical/cache/ResonanceTable.h"
+#include "bio/physical/Wave.h"
+#include "bio/common/container/Bitmap.h"
+
+//@formatter:off
+#if BIO_CPP_VERSION < 11
+	#include <string.h>
+#else
+	#include <cstring>
+#endif
+//@formatter:on
+
+namespace bio {
+namespace physical {
+
+Spectrum::Spectrum()
+{
+	for (
+		unsigned int wrd = 0;
+		wrd < sWordCount;
+		++wrd
+		)
+	{
+		mWords[wrd] = 0;
+	}
+}
+
+Spectrum::Spectrum(const Properties& properties)
+{
+	for (
+		unsigned int wrd = 0;
+		wrd < sWordCount;
+		++wrd
+		)
+	{
+		mWords[wrd] = 0;
+	}
+	for (
+		Properties::const_iterator prp = properties.begin();
+		prp != properties.end();
+		++prp
+		)
+	{
+		Set(*prp);
+	}
+}
+
+Properties Spectrum::AsProperties() const
+{
+	Properties ret;
+	for (
+		unsigned int wrd = 0;
+		wrd < sWordCount;
+		++wrd
+		)
+	{
+		Word word = mWords[wrd];
+		while (word)
+		{
+			unsigned int bit = Bitmap::LowestSetBit(word);
+			ret.Add(Property(uint8_t(wrd * sWordBits + bit)));
+			word &= word - 1;
+		}
+	}
+	return ret;
+}
+
+ResonanceTableImplementation::ResonanceTableImplementation()
+	:
+	mTable(64),
+	mNumberOfSpectra(0),
+	mGeneration(0)
+{
+	Flush();
+}
+
+ResonanceTableImplementation::~ResonanceTableImplementation()
+{
+
+}
+
+Spectrum ResonanceTableImplementation::GetSpectrumOf(const Wave* wave)
+{
+	Spectrum ret;
+	BIO_SANITIZE(wave, ,
+		return ret)
+
+	const ::std::type_info& type = typeid(*wave);
+	const uint64_t offset = GetOffsetOf(wave);
+	const uint64_t key = GetKeyFor(
+		type,
+		offset
+	);
+	uint64_t generation;
+	if (Find(
+		key,
+		type,
+		offset,
+		ret,
+		generation
+	))
+	{
+		return ret;
+	}
+
+	//GetProperties() may need other locks (e.g. the PeriodicTable's), so *this must not be locked here.
+	//If *this is Flush()ed meanwhile, these Properties may be stale, so Record() checks the generation.
+	ret = Spectrum(wave->GetProperties());
+	Record(
+		key,
+		type,
+		offset,
+		ret,
+		generation
+	);
+	return ret;
+}
+
+void ResonanceTableImplementation::Flush()
+{
+	LockThread();
+	for (
+		::std::vector< Entry >::iterator ent = mTable.begin();
+		ent != mTable.end();
+		++ent
+		)
+	{
+		ent->mType = NULL;
+	}
+	mNumberOfSpectra = 0;
+	++mGeneration;
+	UnlockThread();
+}
+
+Index ResonanceTableImplementation::GetNumberOfSpectra() const
+{
+	return mNumberOfSpectra;
+}
+
+/*static*/ uint64_t ResonanceTableImplementation::GetOffsetOf(const Wave* wave)
+{
+	//A type may hold many Waves and each may Resonate differently, so we also note which Wave in the most derived object we were given.
+	return uint64_t(reinterpret_cast< const char* >(wave) - reinterpret_cast< const char* >(dynamic_cast< const void* >(wave)));
+}
+
+/*static*/ uint64_t ResonanceTableImplementation::GetKeyFor(
+	const ::std::type_info& type,
+	const uint64_t offset
+)
+{
+	#if BIO_CPP_VERSION >= 11
+	uint64_t ret = type.hash_code();
+	#else
+	uint64_t ret = 14695981039346656037ULL;
+	for (
+		const char* chr = type.name();
+		*chr;
+		++chr
+		)
+	{
+		ret ^= uint64_t(static_cast< unsigned char >(*chr));
+		ret *= 1099511628211ULL;
+	}
+	#endif
+
+	return ret ^ (offset * 0x9E3779B97F4A7C15ULL);
+}
+
+/*static*/ bool ResonanceTableImplementation::IsEntryFor(
+	const Entry& entry,
+	const ::std::type_info& type,
+	const uint64_t offset
+)
+{
+	if (entry.mOffset != offset)
+	{
+		return false;
+	}
+	#if BIO_CPP_VERSION >= 11
+	return *entry.mType == type;
+	#else
+	//Without hash_code(), types are hashed by name(), so we compare the same.
+	return entry.mType == &type || !::std::strcmp(
+		entry.mType->name(),
+		type.name());
+	#endif
+}
+
+bool ResonanceTableImplementation::Find(
+	const uint64_t key,
+	const ::std::type_info& type,
+	const uint64_t offset,
+	Spectrum& spectrum,
+	uint64_t& generation
+) const
+{
+	LockThreadShared();
+	generation = mGeneration;
+	const ::std::size_t mask = mTable.size() - 1;
+	for (
+		::std::size_t slot = key & mask;
+		mTable[slot].mType;
+		slot = (slot + 1) & mask
+		)
+	{
+		if (mTable[slot].mKey == key && IsEntryFor(
+			mTable[slot],
+			type,
+			offset
+		))
+		{
+			spectrum = mTable[slot].mSpectrum;
+			UnlockThreadShared();
+			return true;
+		}
+	}
+	UnlockThreadShared();
+	return false;
+}
+
+void ResonanceTableImplementation::Record(
+	const uint64_t key,
+	const ::std::type_info& type,
+	const uint64_t offset,
+	const Spectrum& spectrum,
+	const uint64_t generation
+)
+{
+	LockThread();
+	if (generation != mGeneration)
+	{
+		//*this was Flush()ed after spectrum was built, so it may not reflect the newest Properties.
+		UnlockThread();
+		return;
+	}
+	if ((mNumberOfSpectra + 1) * 2 > mTable.size())
+	{
+		::std::vector< Entry > old;
+		old.swap(mTable);
+		mTable.resize(old.size() * 2);
+		for (
+			::std::vector< Entry >::iterator ent = mTable.begin();
+			ent != mTable.end();
+			++ent
+			)
+		{
+			ent->mType = NULL;
+		}
+		for (
+			::std::vector< Entry >::const_iterator ent = old.begin();
+			ent != old.end();
+			++ent
+			)
+		{
+			if (!ent->mType)
+			{
+				continue;
+			}
+			::std::size_t slot = ent->mKey & (mTable.size() - 1);
+			while (mTable[slot].mType)
+			{
+				slot = (slot + 1) & (mTable.size() - 1);
+			}
+			mTable[slot] = *ent;
+		}
+	}
+
+	const ::std::size_t mask = mTable.size() - 1;
+	::std::size_t slot = key & mask;
+	for (
+		;
+		mTable[slot].mType;
+		slot = (slot + 1) & mask
+		)
+	{
+		if (mTable[slot].mKey == key && IsEntryFor(
+			mTable[slot],
+			type,
+			offset
+		))
+		{
+			//Another thread got here first.
+			mTable[slot].mSpectrum = spectrum;
+			UnlockThread();
+			return;
+		}
+	}
+	mTable[slot].mKey = key;
+	mTable[slot].mType = &type;
+	mTable[slot].mOffset = offset;
+	mTable[slot].mSpectrum = spectrum;
+	++mNumberOfSpectra;
+	UnlockThread();
+}
+
+} //physical namespace
+} //bio namespace
@@ -20,7 +20,6 @@
  */
 
 #include "bio/physical/shape/Line.h"
-#include "bio/common/container/Iterator.h"
 
 namespace bio {
 namespace physical {
@@ -28,7 +27,7 @@ namespace physical {
 Line::Line(Index expectedSize)
 	:
 	Arrangement< Linear >(expectedSize),
-	mTempItt(NULL)
+	mNumIndexed(0)
 {
 
 }
@@ -36,18 +35,14 @@ Line::Line(Index expectedSize)
 Line::Line(const Container* other)
 	:
 	Arrangement< Linear >(other),
-	mTempItt(NULL)
+	mNumIndexed(0)
 {
-
+	Reindex();
 }
 
 Line::~Line()
 {
-	if (mTempItt)
-	{
-		delete mTempItt;
-		mTempItt = NULL;
-	}
+
 }
 
 bool Line::AreEqual(
@@ -70,44 +65,282 @@ const Identifiable< Id >* Line::LinearAccess(Index index) const
 	return OptimizedAccess(index).operator const Identifiable< Id >*();
 }
 
-Index Line::SeekToName(const Name& name)
+Index Line::SeekToName(const Name& name) const
 {
-	if (!mTempItt)
+	if (mNameIndex.empty())
 	{
-		mTempItt = ConstructClassIterator();
+		return InvalidIndex();
 	}
-	mTempItt->MoveTo(GetEndIndex());
+
+	//Like other Seeks, if more than 1 content matches, we want the last one.
+	Index ret = InvalidIndex();
+	uint64_t key = name.GetHash();
+	::std::size_t mask = mNameIndex.size() - 1;
 	for (
-		; !mTempItt->IsBeforeBeginning();
-		mTempItt->Decrement()
+		::std::size_t slot = key & mask;
+		mNameIndex[slot].mIndex != InvalidIndex();
+		slot = (slot + 1) & mask
 		)
 	{
-		if (LinearAccess(mTempItt->GetIndex())->IsName(name))
+		if (mNameIndex[slot].mKey == key && mNameIndex[slot].mIndex > ret && LinearAccess(mNameIndex[slot].mIndex)->IsName(name))
 		{
-			return mTempItt->GetIndex();
+			ret = mNameIndex[slot].mIndex;
 		}
 	}
-	return InvalidIndex();
+	return ret;
+}
+
+Index Line::SeekToId(const Id& id) const
+{
+	if (mIdIndex.empty())
+	{
+		return InvalidIndex();
+	}
+
+	//Like other Seeks, if more than 1 content matches, we want the last one.
+	Index ret = InvalidIndex();
+	uint64_t key = GetIdKey(id);
+	::std::size_t mask = mIdIndex.size() - 1;
+	for (
+		::std::size_t slot = key & mask;
+		mIdIndex[slot].mIndex != InvalidIndex();
+		slot = (slot + 1) & mask
+		)
+	{
+		if (mIdIndex[slot].mKey == key && mIdIndex[slot].mIndex > ret && LinearAccess(mIdIndex[slot].mIndex)->IsId(id))
+		{
+			ret = mIdIndex[slot].mIndex;
+		}
+	}
+	return ret;
+}
+
+Index Line::Add(const ByteStream content)
+{
+	Index ret = Arrangement< Linear >::Add(content);
+	if (ret)
+	{
+		IndexContent(ret);
+	}
+	return ret;
+}
+
+Index Line::Insert(
+	const ByteStream content,
+	const Index index
+)
+{
+	if (index && index < mFirstFree)
+	{
+		//Everything at or after index will be moved up by 1.
+		for (
+			IndexTable::iterator ent = mIdIndex.begin();
+			ent != mIdIndex.end();
+			++ent
+			)
+		{
+			if (ent->mIndex >= index)
+			{
+				++ent->mIndex;
+			}
+		}
+		for (
+			IndexTable::iterator ent = mNameIndex.begin();
+			ent != mNameIndex.end();
+			++ent
+			)
+		{
+			if (ent->mIndex >= index)
+			{
+				++ent->mIndex;
+			}
+		}
+	}
+
+	//Container::Insert() will call our Add(), which indexes the new content.
+	return Arrangement< Linear >::Insert(
+		content,
+		index
+	);
+}
+
+ByteStream Line::Erase(Index index)
+{
+	if (IsAllocated(index))
+	{
+		UnindexContent(index);
+	}
+	return Arrangement< Linear >::Erase(index);
 }
 
-Index Line::SeekToId(const Id& id)
+void Line::Clear()
 {
-	if (!mTempItt)
+	Arrangement< Linear >::Clear();
+	mIdIndex.clear();
+	mNameIndex.clear();
+	mNumIndexed = 0;
+}
+
+void Line::Reindex()
+{
+	//Keep the load factor at or below 1/2.
+	::std::size_t size = 16;
+	while (size < GetNumberOfElements() * 2 + 2)
 	{
-		mTempItt = ConstructClassIterator();
+		size *= 2;
 	}
-	mTempItt->MoveTo(GetEndIndex());
+
+	IndexEntry empty;
+	empty.mKey = 0;
+	empty.mIndex = InvalidIndex();
+	mIdIndex.assign(
+		size,
+		empty
+	);
+	mNameIndex.assign(
+		size,
+		empty
+	);
+	mNumIndexed = 0;
+
+	const Identifiable< Id >* content;
 	for (
-		; !mTempItt->IsBeforeBeginning();
-		mTempItt->Decrement()
+		Index cnt = GetBeginIndex();
+		cnt != InvalidIndex();
+		cnt = GetNextAllocatedIndex(cnt + 1)
 		)
 	{
-		if (LinearAccess(mTempItt->GetIndex())->IsId(id))
+		content = LinearAccess(cnt);
+		InsertIntoTable(
+			mIdIndex,
+			GetIdKey(content->GetId()),
+			cnt
+		);
+		InsertIntoTable(
+			mNameIndex,
+			content->GetName().GetHash(),
+			cnt
+		);
+		++mNumIndexed;
+	}
+}
+
+/*static*/ uint64_t Line::GetIdKey(const Id& id)
+{
+	//Ids are dense, so we spread them out with Fibonacci hashing.
+	uint64_t ret = Id(id);
+	ret *= 11400714819323198485ULL;
+	return ret ^ (ret >> 32);
+}
+
+/*static*/ void Line::InsertIntoTable(
+	IndexTable& table,
+	const uint64_t key,
+	const Index index
+)
+{
+	::std::size_t mask = table.size() - 1;
+	::std::size_t slot = key & mask;
+	while (table[slot].mIndex != InvalidIndex())
+	{
+		slot = (slot + 1) & mask;
+	}
+	table[slot].mKey = key;
+	table[slot].mIndex = index;
+}
+
+/*static*/ void Line::RemoveFromTable(
+	IndexTable& table,
+	const uint64_t key,
+	const Index index
+)
+{
+	if (table.empty())
+	{
+		return;
+	}
+	::std::size_t mask = table.size() - 1;
+	::std::size_t slot = key & mask;
+	while (table[slot].mIndex != index || table[slot].mKey != key)
+	{
+		if (table[slot].mIndex == InvalidIndex())
 		{
-			return mTempItt->GetIndex();
+			//The content at index may have changed its key since it was indexed, in which case we still have to forget its Index.
+			for (
+				slot = 0;
+				slot < table.size() && table[slot].mIndex != index;
+				++slot
+				)
+			{
+			}
+			if (slot == table.size())
+			{
+				return;
+			}
+			break;
 		}
+		slot = (slot + 1) & mask;
+	}
+
+	//Backward shift deletion: move later entries of the probe sequence into the hole, so that no probe sequence is broken.
+	::std::size_t hole = slot;
+	::std::size_t home;
+	for (
+		slot = (hole + 1) & mask;
+		table[slot].mIndex != InvalidIndex();
+		slot = (slot + 1) & mask
+		)
+	{
+		home = table[slot].mKey & mask;
+		//Move slot into hole only if home is not cyclically within (hole, slot].
+		if (((slot - home) & mask) >= ((slot - hole) & mask))
+		{
+			table[hole] = table[slot];
+			hole = slot;
+		}
+	}
+	table[hole].mIndex = InvalidIndex();
+}
+
+void Line::IndexContent(const Index index)
+{
+	if ((mNumIndexed + 1) * 2 > mIdIndex.size())
+	{
+		//Reindex picks up the content at index, since it has already been added.
+		Reindex();
+		return;
+	}
+	const Identifiable< Id >* content = LinearAccess(index);
+	InsertIntoTable(
+		mIdIndex,
+		GetIdKey(content->GetId()),
+		index
+	);
+	InsertIntoTable(
+		mNameIndex,
+		content->GetName().GetHash(),
+		index
+	);
+	++mNumIndexed;
+}
+
+void Line::UnindexContent(const Index index)
+{
+	const Identifiable< Id >* content = LinearAccess(index);
+	RemoveFromTable(
+		mIdIndex,
+		GetIdKey(content->GetId()),
+		index
+	);
+	RemoveFromTable(
+		mNameIndex,
+		content->GetName().GetHash(),
+		index
+	);
+	if (mNumIndexed)
+	{
+		--mNumIndexed;
 	}
-	return InvalidIndex();
 }
 
 } //physical namespace